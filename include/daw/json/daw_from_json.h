@@ -12,7 +12,9 @@
 
 #include "daw_from_json_fwd.h"
 #include "impl/daw_json_parse_class.h"
+#include "impl/daw_json_parse_into.h"
 #include "impl/daw_json_parse_value.h"
+#include "impl/daw_json_projection.h"
 #include "impl/daw_json_value.h"
 
 #include <daw/daw_data_end.h>
@@ -24,6 +26,43 @@
 
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			/// @brief The ParseState for a whole document of type String parsed
+			/// with PolicyFlags
+			template<typename String, json_options_t PolicyFlags>
+			using document_parse_state_t = daw::conditional_t<
+			  apply_zstring_policy_option_t<
+			    BasicParsePolicy<PolicyFlags>, String,
+			    options::ZeroTerminatedString::yes>::is_default_parse_policy,
+			  DefaultParsePolicy,
+			  apply_zstring_policy_option_t<BasicParsePolicy<PolicyFlags>, String,
+			                                options::ZeroTerminatedString::yes>>;
+
+			/// @brief Check that json_data is a non-empty document and create the
+			/// ParseState over it.  A trailing zero is not part of the document, when
+			/// String is known to have one the parser is allowed to rely on it
+			template<json_options_t PolicyFlags, typename String>
+			[[nodiscard]] constexpr document_parse_state_t<String, PolicyFlags>
+			make_document_parse_state( String &&json_data ) {
+				static_assert(
+				  is_string_view_like_v<String>,
+				  "String type must have a be a contiguous range of Characters" );
+				static_assert( not BasicParsePolicy<PolicyFlags>::in_place_unescape or
+				                 is_mutable_string_v<String>,
+				               "options::InPlaceUnescape requires a mutable buffer" );
+				daw_json_ensure( std::data( json_data ) != nullptr,
+				                 ErrorReason::EmptyJSONDocument );
+				daw_json_ensure( std::size( json_data ) != 0,
+				                 ErrorReason::EmptyJSONDocument );
+
+				auto first = std::data( json_data );
+				auto last = daw::data_end( json_data );
+				if( first != last and last[-1] == 0 ) {
+					--last;
+				}
+				return document_parse_state_t<String, PolicyFlags>( first, last );
+			}
+		} // namespace json_details
 
 		/// @brief Construct the JSONMember from the JSON document argument.
 		/// @tparam JsonMember any bool, arithmetic, string, string_view,
@@ -37,36 +76,14 @@ namespace daw::json {
 		         auto... PolicyFlags>
 		[[nodiscard]] constexpr auto
 		from_json( String &&json_data, options::parse_flags_t<PolicyFlags...> ) {
-			static_assert(
-			  json_details::is_string_view_like_v<String>,
-			  "String type must have a be a contiguous range of Characters" );
-			daw_json_ensure( std::data( json_data ) != nullptr,
-			                 ErrorReason::EmptyJSONDocument );
-			daw_json_ensure( std::size( json_data ) != 0,
-			                 ErrorReason::EmptyJSONDocument );
-
 			static_assert(
 			  json_details::has_json_deduced_type_v<JsonMember>,
 			  "Missing specialization of daw::json::json_data_contract for class "
 			  "mapping or specialization of daw::json::json_link_basic_type_map" );
 			using json_member = json_details::json_deduced_type<JsonMember>;
-			using ParsePolicy =
-			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
-
-			/// If the string is known to have a trailing zero, allow optimization on
-			/// that
-			using policy_zstring_t = json_details::apply_zstring_policy_option_t<
-			  ParsePolicy, String, options::ZeroTerminatedString::yes>;
-
-			using ParseState =
-			  daw::conditional_t<policy_zstring_t::is_default_parse_policy,
-			                     DefaultParsePolicy, policy_zstring_t>;
-			auto first = std::data( json_data );
-			auto last = daw::data_end( json_data );
-			if( first != last and last[-1] == 0 ) {
-				--last;
-			}
-			auto parse_state = ParseState( first, last );
+			auto parse_state = json_details::make_document_parse_state<
+			  options::parse_flags_t<PolicyFlags...>::value>( json_data );
+			using ParseState = decltype( parse_state );
 
 			if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
 				auto result =
@@ -100,6 +117,98 @@ namespace daw::json {
 			                                           options::parse_flags<> );
 		}
 
+		/// @brief Construct T from the JSON document, only parsing the members
+		/// selected by projection.  The other members are value initialized
+		/// @tparam T A class mapped with a json_member_list
+		/// @param json_data JSON string data
+		/// @param projection The members of T to parse
+		/// @return A T constructed from JSON data
+		/// @throws daw::json::json_exception
+		template<typename T, typename String, auto... PolicyFlags>
+		[[nodiscard]] constexpr T
+		from_json( String &&json_data, json_projection<T> const &projection,
+		           options::parse_flags_t<PolicyFlags...> ) {
+			static_assert(
+			  json_details::is_json_member_list_v<json_data_contract_trait_t<T>>,
+			  "Only classes mapped with a json_member_list can be projected" );
+			using json_member = json_details::json_deduced_type<T>;
+			auto parse_state = json_details::make_document_parse_state<
+			  options::parse_flags_t<PolicyFlags...>::value>( json_data );
+			using ParseState = decltype( parse_state );
+			parse_state.trim_left( );
+			daw_json_assert_weak( parse_state.has_more( ),
+			                      ErrorReason::UnexpectedEndOfData, parse_state );
+
+			auto result =
+			  json_data_contract_trait_t<T>::template parse_to_class<json_member,
+			                                                         false>(
+			    parse_state, projection );
+			parse_state.trim_left( );
+			if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
+				daw_json_ensure( parse_state.empty( ), ErrorReason::InvalidEndOfValue,
+				                 parse_state );
+			}
+			return result;
+		}
+
+		/// @brief Construct T from the JSON document, only parsing the members
+		/// selected by projection.  The other members are value initialized
+		/// @tparam T A class mapped with a json_member_list
+		/// @param json_data JSON string data
+		/// @param projection The members of T to parse
+		/// @return A T constructed from JSON data
+		/// @throws daw::json::json_exception
+		template<typename T, typename String>
+		[[nodiscard]] constexpr T
+		from_json( String &&json_data, json_projection<T> const &projection ) {
+			return from_json<T>( DAW_FWD( json_data ), projection,
+			                     options::parse_flags<> );
+		}
+
+		/// @brief Parse the JSON document into an existing T.  Strings, containers,
+		/// key/value maps and mapped classes are assigned to in place, reusing
+		/// the storage they already have.  Classes must return references to
+		/// their members from to_json_data, otherwise they are parsed and
+		/// assigned
+		/// @tparam JsonMember The mapping of T
+		/// @param target The value to parse into
+		/// @param json_data JSON string data
+		/// @throws daw::json::json_exception
+		template<typename JsonMember, typename T, typename String,
+		         auto... PolicyFlags>
+		constexpr void from_json_into( T &target, String &&json_data,
+		                               options::parse_flags_t<PolicyFlags...> ) {
+			using json_member = json_details::json_deduced_type<
+			  daw::conditional_t<std::is_same_v<JsonMember, use_default>, T,
+			                     JsonMember>>;
+			static_assert(
+			  std::is_same_v<json_details::json_result_t<json_member>, T>,
+			  "The mapping must parse to T" );
+			auto parse_state = json_details::make_document_parse_state<
+			  options::parse_flags_t<PolicyFlags...>::value>( json_data );
+			using ParseState = decltype( parse_state );
+
+			json_details::parse_value_into<json_member, false>( parse_state, target );
+			if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
+				parse_state.trim_left( );
+				daw_json_ensure( parse_state.empty( ), ErrorReason::InvalidEndOfValue,
+				                 parse_state );
+			}
+		}
+
+		/// @brief Parse the JSON document into an existing T.  Strings, containers,
+		/// key/value maps and mapped classes are assigned to in place, reusing
+		/// the storage they already have
+		/// @tparam JsonMember The mapping of T
+		/// @param target The value to parse into
+		/// @param json_data JSON string data
+		/// @throws daw::json::json_exception
+		template<typename JsonMember, typename T, typename String>
+		constexpr void from_json_into( T &target, String &&json_data ) {
+			from_json_into<JsonMember>( target, DAW_FWD( json_data ),
+			                            options::parse_flags<> );
+		}
+
 		/// @brief Construct the JSONMember from the JSON document argument.
 		/// @tparam JsonMember any bool, arithmetic, string, string_view,
 		/// daw::json::json_data_contract
@@ -134,6 +243,9 @@ namespace daw::json {
 
 			using ParsePolicy =
 			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
+			static_assert( not ParsePolicy::in_place_unescape or
+			                 json_details::is_mutable_string_v<String>,
+			               "options::InPlaceUnescape requires a mutable buffer" );
 
 			/// @brief If the string is known to have a trailing zero, allow
 			/// optimization on that
@@ -209,6 +321,9 @@ namespace daw::json {
 
 			using ParsePolicy =
 			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
+			static_assert( not ParsePolicy::in_place_unescape or
+			                 json_details::is_mutable_string_v<String>,
+			               "options::InPlaceUnescape requires a mutable buffer" );
 
 			/// @brief If the string is known to have a trailing zero, allow
 			/// optimization on that
@@ -306,6 +421,9 @@ namespace daw::json {
 
 			using ParsePolicy =
 			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
+			static_assert( not ParsePolicy::in_place_unescape or
+			                 json_details::is_mutable_string_v<String>,
+			               "options::InPlaceUnescape requires a mutable buffer" );
 
 			/// @brief If the string is known to have a trailing zero, allow
 			/// optimization on that
@@ -385,8 +503,10 @@ namespace daw::json {
 			  json_details::has_unnamed_default_type_mapping_v<JsonMember>,
 			  "Missing specialization of daw::json::json_data_contract for class "
 			  "mapping or specialization of daw::json::json_link_basic_type_map" );
-			using ParsePolicy = typename BasicParsePolicy<
-			  P, Allocator>::template SetPolicyOptions<PolicyFlags...>;
+			// A json_value can be parsed more than once
+			using ParsePolicy = json_details::reread_parse_state_t<
+			  typename BasicParsePolicy<P, Allocator>::template SetPolicyOptions<
+			    PolicyFlags...>>;
 			using ParseState =
 			  daw::conditional_t<ParsePolicy::is_default_parse_policy,
 			                     DefaultParsePolicy, ParsePolicy>;
@@ -438,8 +558,9 @@ namespace daw::json {
 			  json_details::has_unnamed_default_type_mapping_v<JsonMember>,
 			  "Missing specialization of daw::json::json_data_contract for class "
 			  "mapping or specialization of daw::json::json_link_basic_type_map" );
-			using ParsePolicy =
-			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
+			// A json_value can be parsed more than once
+			using ParsePolicy = json_details::reread_parse_state_t<
+			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>>;
 			auto const old_parse_state = value.get_raw_state( );
 			using ParseState =
 			  daw::conditional_t<ParsePolicy::is_default_parse_policy,
@@ -519,6 +640,9 @@ namespace daw::json {
 
 			using ParsePolicy =
 			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
+			static_assert( not ParsePolicy::in_place_unescape or
+			                 json_details::is_mutable_string_v<String>,
+			               "options::InPlaceUnescape requires a mutable buffer" );
 
 			/// @brief If the string is known to have a trailing zero, allow
 			/// optimization on that
@@ -613,6 +737,9 @@ namespace daw::json {
 
 			using ParsePolicy =
 			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
+			static_assert( not ParsePolicy::in_place_unescape or
+			                 json_details::is_mutable_string_v<String>,
+			               "options::InPlaceUnescape requires a mutable buffer" );
 
 			/// @brief If the string is known to have a trailing zero, allow
 			/// optimization on that
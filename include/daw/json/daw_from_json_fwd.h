@@ -137,6 +137,54 @@ namespace daw::json {
 		                                              std::string_view member_path,
 		                                              Allocator const &alloc );
 
+		template<typename T>
+		class json_projection;
+
+		/// @brief Construct T from the JSON document, only parsing the members
+		/// selected by projection.  The other members are value initialized
+		/// @tparam T A class mapped with a json_member_list
+		/// @param json_data JSON string data
+		/// @param projection The members of T to parse
+		/// @return A T constructed from JSON data
+		/// @throws daw::json::json_exception
+		template<typename T, typename String, auto... PolicyFlags>
+		[[nodiscard]] constexpr T
+		from_json( String &&json_data, json_projection<T> const &projection,
+		           options::parse_flags_t<PolicyFlags...> );
+
+		/// @brief Construct T from the JSON document, only parsing the members
+		/// selected by projection.  The other members are value initialized
+		/// @tparam T A class mapped with a json_member_list
+		/// @param json_data JSON string data
+		/// @param projection The members of T to parse
+		/// @return A T constructed from JSON data
+		/// @throws daw::json::json_exception
+		template<typename T, typename String>
+		[[nodiscard]] constexpr T
+		from_json( String &&json_data, json_projection<T> const &projection );
+
+		/// @brief Parse the JSON document into an existing T.  Strings, containers,
+		/// key/value maps and mapped classes are assigned to in place, reusing
+		/// the storage they already have
+		/// @tparam JsonMember The mapping of T
+		/// @param target The value to parse into
+		/// @param json_data JSON string data
+		/// @throws daw::json::json_exception
+		template<typename JsonMember = use_default, typename T, typename String,
+		         auto... PolicyFlags>
+		constexpr void from_json_into( T &target, String &&json_data,
+		                               options::parse_flags_t<PolicyFlags...> );
+
+		/// @brief Parse the JSON document into an existing T.  Strings, containers,
+		/// key/value maps and mapped classes are assigned to in place, reusing
+		/// the storage they already have
+		/// @tparam JsonMember The mapping of T
+		/// @param target The value to parse into
+		/// @param json_data JSON string data
+		/// @throws daw::json::json_exception
+		template<typename JsonMember = use_default, typename T, typename String>
+		constexpr void from_json_into( T &target, String &&json_data );
+
 		/// @brief Parse a value from a json_value
 		/// @tparam JsonMember The type of the item being parsed
 		/// @param value JSON data, see basic_json_value
@@ -0,0 +1,644 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_json_lines_iterator.h"
+#include "daw_json_link.h"
+#include "impl/daw_json_assert.h"
+
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/***
+ * Columnar export of JSON Lines documents in the Apache Arrow memory layout.
+ * Each member of a class mapped with a json_member_list is appended to a
+ * column holding Arrow's buffers: an LSB ordered validity bitmap and either a
+ * fixed width value buffer, a bit packed boolean buffer, or int32 offsets
+ * into one contiguous string arena.  The Arrow library is not needed, the
+ * buffers can be handed to it(e.g. via the C data interface) or to any
+ * consumer of that layout.  The buffers are not padded to 64 bytes.
+ */
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/***
+		 * A bitmap in Arrow's layout.  Bit i is bit i % 8 of byte i / 8
+		 */
+		class arrow_bitmap {
+			std::vector<std::uint8_t> m_bytes{ };
+			std::size_t m_size = 0;
+
+		public:
+			inline void push_back( bool bit ) {
+				if( m_size % 8U == 0 ) {
+					m_bytes.push_back( 0 );
+				}
+				if( bit ) {
+					m_bytes.back( ) |= static_cast<std::uint8_t>( 1U << ( m_size % 8U ) );
+				}
+				++m_size;
+			}
+
+			[[nodiscard]] inline bool test( std::size_t idx ) const {
+				return ( ( m_bytes[idx / 8U] >> ( idx % 8U ) ) & 1U ) != 0;
+			}
+
+			/// @brief The number of bits
+			[[nodiscard]] inline std::size_t size( ) const {
+				return m_size;
+			}
+
+			/// @brief The bytes of the bitmap, the bits past size( ) are 0
+			[[nodiscard]] inline std::vector<std::uint8_t> const &bytes( ) const {
+				return m_bytes;
+			}
+
+			inline void reserve( std::size_t bit_count ) {
+				m_bytes.reserve( bit_count / 8U + 1U );
+			}
+
+			/// @brief The number of bits at or after idx that are not set
+			[[nodiscard]] inline std::size_t count_unset_from( std::size_t idx ) const {
+				std::size_t result = 0;
+				for( ; idx < m_size; ++idx ) {
+					result += test( idx ) ? 0U : 1U;
+				}
+				return result;
+			}
+
+			/// @brief Remove the bits after the first bit_count
+			inline void truncate( std::size_t bit_count ) {
+				if( bit_count >= m_size ) {
+					return;
+				}
+				m_size = bit_count;
+				m_bytes.resize( ( bit_count + 7U ) / 8U );
+				if( bit_count % 8U != 0 ) {
+					m_bytes.back( ) &=
+					  static_cast<std::uint8_t>( ( 1U << ( bit_count % 8U ) ) - 1U );
+				}
+			}
+
+			/// @brief Remove all bits and keep the capacity
+			inline void clear( ) {
+				m_bytes.clear( );
+				m_size = 0;
+			}
+		};
+
+		/***
+		 * An Arrow fixed width primitive column
+		 * @tparam T An arithmetic type other than bool
+		 */
+		template<typename T>
+		class arrow_fixed_column {
+			static_assert( std::is_arithmetic_v<T> and not std::is_same_v<T, bool>,
+			               "Fixed width columns hold numbers, bool uses "
+			               "arrow_bool_column" );
+			std::vector<T> m_values{ };
+			arrow_bitmap m_validity{ };
+			std::size_t m_null_count = 0;
+
+		public:
+			using value_type = T;
+
+			inline void emplace_back( T value ) {
+				m_values.push_back( value );
+				m_validity.push_back( true );
+			}
+
+			/// @brief Append a value or a null, nulls have a value of 0
+			template<typename U>
+			inline void emplace_back( std::optional<U> const &value ) {
+				if( value ) {
+					emplace_back( static_cast<T>( *value ) );
+					return;
+				}
+				m_values.push_back( T{ } );
+				m_validity.push_back( false );
+				++m_null_count;
+			}
+
+			[[nodiscard]] inline std::vector<T> const &values( ) const {
+				return m_values;
+			}
+
+			[[nodiscard]] inline arrow_bitmap const &validity( ) const {
+				return m_validity;
+			}
+
+			[[nodiscard]] inline std::size_t null_count( ) const {
+				return m_null_count;
+			}
+
+			[[nodiscard]] inline std::size_t size( ) const {
+				return m_values.size( );
+			}
+
+			inline void reserve( std::size_t row_count ) {
+				m_values.reserve( row_count );
+				m_validity.reserve( row_count );
+			}
+
+			/// @brief Remove the rows after the first row_count
+			inline void truncate( std::size_t row_count ) {
+				if( row_count >= size( ) ) {
+					return;
+				}
+				m_null_count -= m_validity.count_unset_from( row_count );
+				m_values.resize( row_count );
+				m_validity.truncate( row_count );
+			}
+
+			/// @brief Remove all rows and keep the capacity
+			inline void clear( ) {
+				m_values.clear( );
+				m_validity.clear( );
+				m_null_count = 0;
+			}
+		};
+
+		/***
+		 * An Arrow boolean column, the values are bit packed
+		 */
+		class arrow_bool_column {
+			arrow_bitmap m_values{ };
+			arrow_bitmap m_validity{ };
+			std::size_t m_null_count = 0;
+
+		public:
+			using value_type = bool;
+
+			inline void emplace_back( bool value ) {
+				m_values.push_back( value );
+				m_validity.push_back( true );
+			}
+
+			/// @brief Append a value or a null, nulls have a value of false
+			inline void emplace_back( std::optional<bool> const &value ) {
+				m_values.push_back( value.value_or( false ) );
+				m_validity.push_back( value.has_value( ) );
+				m_null_count += value.has_value( ) ? 0U : 1U;
+			}
+
+			[[nodiscard]] inline arrow_bitmap const &values( ) const {
+				return m_values;
+			}
+
+			[[nodiscard]] inline arrow_bitmap const &validity( ) const {
+				return m_validity;
+			}
+
+			[[nodiscard]] inline std::size_t null_count( ) const {
+				return m_null_count;
+			}
+
+			[[nodiscard]] inline std::size_t size( ) const {
+				return m_values.size( );
+			}
+
+			inline void reserve( std::size_t row_count ) {
+				m_values.reserve( row_count );
+				m_validity.reserve( row_count );
+			}
+
+			/// @brief Remove the rows after the first row_count
+			inline void truncate( std::size_t row_count ) {
+				if( row_count >= size( ) ) {
+					return;
+				}
+				m_null_count -= m_validity.count_unset_from( row_count );
+				m_values.truncate( row_count );
+				m_validity.truncate( row_count );
+			}
+
+			/// @brief Remove all rows and keep the capacity
+			inline void clear( ) {
+				m_values.clear( );
+				m_validity.clear( );
+				m_null_count = 0;
+			}
+		};
+
+		namespace json_details {
+			/***
+			 * The text of a JSON string with its escapes still in it.  It points
+			 * into the document and is unescaped with ParsePolicy when it is
+			 * appended to an arrow_string_column
+			 */
+			template<bool AllowHighEight, typename ParsePolicy>
+			struct arrow_escaped_string {
+				char const *first = nullptr;
+				std::size_t size = 0;
+
+				arrow_escaped_string( ) = default;
+
+				constexpr arrow_escaped_string( char const *ptr, std::size_t sz )
+				  : first( ptr )
+				  , size( sz ) {}
+			};
+
+			/// @brief JsonMember with another mapping for its value
+			template<typename JsonMember, typename WithoutName>
+			struct arrow_renamed_member : WithoutName {
+				static constexpr daw::string_view name = JsonMember::name;
+
+				using without_name = WithoutName;
+			};
+
+			/***
+			 * The policy of the document a string came from, for unescaping it on
+			 * its own.  The string is not zero terminated and is not unescaped in
+			 * place, it is copied into the arena
+			 */
+			template<typename ParseState>
+			using arrow_unescape_policy_t =
+			  typename ParseState::without_allocator_type::template SetPolicyOptions<
+			    options::ZeroTerminatedString::no, options::InPlaceUnescape::no>;
+
+			/***
+			 * Escaped std::string members are parsed raw, to be unescaped straight
+			 * into the arena of the column.  The others are parsed as mapped
+			 */
+			template<typename JsonMember, typename ParseState,
+			         typename WithoutName = typename JsonMember::without_name>
+			struct arrow_string_member {
+				using type = JsonMember;
+			};
+
+			template<typename JsonMember, typename ParseState,
+			         json_options_t Options>
+			struct arrow_string_member<
+			  JsonMember, ParseState,
+			  json_base::json_string<std::string, Options, use_default>> {
+				using escaped_t = arrow_escaped_string<
+				  json_base::json_string<std::string, Options>::eight_bit_mode !=
+				    options::EightBitModes::DisallowHigh,
+				  arrow_unescape_policy_t<ParseState>>;
+				using type = arrow_renamed_member<
+				  JsonMember, json_base::json_string_raw<escaped_t>>;
+			};
+
+			template<typename JsonMember, typename ParseState,
+			         json_options_t Options, JsonNullable NullableType>
+			struct arrow_string_member<
+			  JsonMember, ParseState,
+			  json_base::json_nullable<std::optional<std::string>,
+			                           json_base::json_string<std::string, Options>,
+			                           NullableType, use_default>> {
+				using escaped_t = arrow_escaped_string<
+				  json_base::json_string<std::string, Options>::eight_bit_mode !=
+				    options::EightBitModes::DisallowHigh,
+				  arrow_unescape_policy_t<ParseState>>;
+				using type = arrow_renamed_member<
+				  JsonMember,
+				  json_base::json_nullable<std::optional<escaped_t>,
+				                           json_base::json_string_raw<escaped_t>,
+				                           NullableType>>;
+			};
+
+			/// @brief The unused end of a string arena as a string, so that a string
+			/// can be unescaped straight into it
+			struct arrow_arena_tail {
+				std::vector<char> *arena;
+				std::size_t offset;
+
+				[[nodiscard]] inline char *data( ) {
+					return arena->data( ) + offset;
+				}
+
+				[[nodiscard]] inline std::size_t size( ) const {
+					return arena->size( ) - offset;
+				}
+
+				inline void resize( std::size_t sz ) {
+					arena->resize( offset + sz );
+				}
+			};
+		} // namespace json_details
+
+		/***
+		 * An Arrow utf8 column.  The strings are appended to one arena and row i
+		 * is data( )[offsets( )[i], offsets( )[i + 1])
+		 */
+		class arrow_string_column {
+			std::vector<std::int32_t> m_offsets = std::vector<std::int32_t>( 1 );
+			std::vector<char> m_data{ };
+			arrow_bitmap m_validity{ };
+			std::size_t m_null_count = 0;
+
+		public:
+			using value_type = std::string_view;
+
+			/// @brief Escaped strings are parsed raw and unescaped into data( )
+			/// instead of into a temporary std::string
+			template<typename JsonMember, typename ParseState>
+			using json_member_t =
+			  typename json_details::arrow_string_member<JsonMember,
+			                                             ParseState>::type;
+
+			inline void emplace_back( std::string_view value ) {
+				daw_json_ensure(
+				  std::size( value ) <=
+				    static_cast<std::size_t>(
+				      ( std::numeric_limits<std::int32_t>::max )( ) ) -
+				      m_data.size( ),
+				  ErrorReason::NumberOutOfRange );
+				m_data.insert( m_data.end( ), std::data( value ),
+				               std::data( value ) + std::size( value ) );
+				m_offsets.push_back( static_cast<std::int32_t>( m_data.size( ) ) );
+				m_validity.push_back( true );
+			}
+
+			/// @brief Unescape a JSON string and append it
+			template<bool AllowHighEight, typename ParsePolicy>
+			void emplace_back(
+			  json_details::arrow_escaped_string<AllowHighEight, ParsePolicy> const
+			    &value ) {
+				auto const old_size = m_data.size( );
+				daw_json_ensure(
+				  value.size <= static_cast<std::size_t>(
+				                  ( std::numeric_limits<std::int32_t>::max )( ) ) -
+				                  old_size,
+				  ErrorReason::NumberOutOfRange );
+				if( value.size > 0 ) {
+					auto tail = json_details::arrow_arena_tail{ &m_data, old_size };
+					auto parse_state =
+					  ParsePolicy( value.first, value.first + value.size );
+#if defined( DAW_USE_EXCEPTIONS )
+					try {
+#endif
+						json_details::parse_string_known_stdstring_into<AllowHighEight,
+						                                                true>(
+						  parse_state, tail );
+#if defined( DAW_USE_EXCEPTIONS )
+					} catch( ... ) {
+						m_data.resize( old_size );
+						throw;
+					}
+#endif
+				}
+				m_offsets.push_back( static_cast<std::int32_t>( m_data.size( ) ) );
+				m_validity.push_back( true );
+			}
+
+			/// @brief Append a string or a null, nulls are empty strings
+			template<typename String>
+			inline void emplace_back( std::optional<String> const &value ) {
+				if( value ) {
+					emplace_back( *value );
+					return;
+				}
+				m_offsets.push_back( m_offsets.back( ) );
+				m_validity.push_back( false );
+				++m_null_count;
+			}
+
+			/// @brief The size( ) + 1 offsets into data( )
+			[[nodiscard]] inline std::vector<std::int32_t> const &offsets( ) const {
+				return m_offsets;
+			}
+
+			[[nodiscard]] inline std::vector<char> const &data( ) const {
+				return m_data;
+			}
+
+			[[nodiscard]] inline std::string_view operator[]( std::size_t idx ) const {
+				auto const first = static_cast<std::size_t>( m_offsets[idx] );
+				auto const last = static_cast<std::size_t>( m_offsets[idx + 1] );
+				return std::string_view( m_data.data( ) + first, last - first );
+			}
+
+			[[nodiscard]] inline arrow_bitmap const &validity( ) const {
+				return m_validity;
+			}
+
+			[[nodiscard]] inline std::size_t null_count( ) const {
+				return m_null_count;
+			}
+
+			[[nodiscard]] inline std::size_t size( ) const {
+				return m_offsets.size( ) - 1U;
+			}
+
+			inline void reserve( std::size_t row_count ) {
+				m_offsets.reserve( row_count + 1U );
+				m_validity.reserve( row_count );
+			}
+
+			/// @brief Remove the rows after the first row_count
+			inline void truncate( std::size_t row_count ) {
+				if( row_count >= size( ) ) {
+					return;
+				}
+				m_null_count -= m_validity.count_unset_from( row_count );
+				m_offsets.resize( row_count + 1U );
+				m_data.resize( static_cast<std::size_t>( m_offsets.back( ) ) );
+				m_validity.truncate( row_count );
+			}
+
+			/// @brief Remove all rows and keep the capacity
+			inline void clear( ) {
+				m_offsets.resize( 1 );
+				m_data.clear( );
+				m_validity.clear( );
+				m_null_count = 0;
+			}
+		};
+
+		namespace json_details {
+			template<typename T>
+			struct arrow_column {
+				static_assert( std::is_arithmetic_v<T>,
+				               "Only numbers, bool, and strings have a default Arrow "
+				               "column" );
+				using type = arrow_fixed_column<T>;
+			};
+
+			template<>
+			struct arrow_column<bool> {
+				using type = arrow_bool_column;
+			};
+
+			template<>
+			struct arrow_column<std::string> {
+				using type = arrow_string_column;
+			};
+
+			template<>
+			struct arrow_column<std::string_view> {
+				using type = arrow_string_column;
+			};
+
+			template<typename T>
+			struct arrow_column<std::optional<T>> : arrow_column<T> {};
+
+			template<typename MemberList>
+			struct arrow_columns;
+
+			template<typename... JsonMembers>
+			struct arrow_columns<json_member_list<JsonMembers...>> {
+				using type =
+				  std::tuple<typename arrow_column<json_result_t<JsonMembers>>::type...>;
+			};
+		} // namespace json_details
+
+		/***
+		 * The Arrow columns of the members of T, in the order of its
+		 * json_member_list.  Numbers, bool, strings, and std::optional of them are
+		 * supported
+		 * @tparam T A class mapped with a json_member_list
+		 */
+		template<typename T>
+		using arrow_columns_t =
+		  typename json_details::arrow_columns<json_data_contract_trait_t<T>>::type;
+
+		/***
+		 * Accumulate the rows of a JSON Lines document into batches of Arrow
+		 * columns.  The rows are never constructed as T, the members are parsed
+		 * straight into their columns.  The columns keep their capacity between
+		 * batches
+		 * @tparam T A class mapped with a json_member_list
+		 * @tparam Columns A tuple of columns, one per member of T, with
+		 * emplace_back, reserve, truncate and clear
+		 */
+		template<typename T, typename Columns = arrow_columns_t<T>>
+		class json_arrow_batch_builder {
+			Columns m_columns{ };
+			std::size_t m_batch_size;
+			std::size_t m_size = 0;
+
+		public:
+			using columns_type = Columns;
+
+			/// @param batch_size The number of rows in a full batch
+			explicit json_arrow_batch_builder( std::size_t batch_size )
+			  : m_batch_size( batch_size ) {
+				daw_json_ensure( batch_size > 0, ErrorReason::NumberOutOfRange );
+				std::apply(
+				  [&]( auto &...columns ) {
+					  ( columns.reserve( batch_size ), ... );
+				  },
+				  m_columns );
+			}
+
+			[[nodiscard]] std::size_t batch_size( ) const {
+				return m_batch_size;
+			}
+
+			/// @brief The number of rows in the current batch
+			[[nodiscard]] std::size_t size( ) const {
+				return m_size;
+			}
+
+			[[nodiscard]] bool full( ) const {
+				return m_size >= m_batch_size;
+			}
+
+			[[nodiscard]] Columns const &columns( ) const {
+				return m_columns;
+			}
+
+			/// @brief Append the row at it to the batch, it is not moved.  When the
+			/// row has an error the batch is left as it was
+			/// @pre it.good( ) and not full( )
+			template<typename JsonElement, auto... PolicyFlags>
+			void
+			append( json_lines_iterator<JsonElement, PolicyFlags...> const &it ) {
+#if defined( DAW_USE_EXCEPTIONS )
+				try {
+#endif
+					it.parse_to_columns( m_columns );
+#if defined( DAW_USE_EXCEPTIONS )
+				} catch( ... ) {
+					// The columns before the one that failed already have the row
+					std::apply(
+					  [&]( auto &...columns ) {
+						  ( columns.truncate( m_size ), ... );
+					  },
+					  m_columns );
+					throw;
+				}
+#endif
+				++m_size;
+			}
+
+			/// @brief Append rows until the batch is full or first == last.
+			/// @return true when the batch is full
+			template<typename JsonElement, auto... PolicyFlags>
+			bool fill( json_lines_iterator<JsonElement, PolicyFlags...> &first,
+			           json_lines_iterator<JsonElement, PolicyFlags...> const &last ) {
+				while( not full( ) and first != last ) {
+					append( first );
+					++first;
+				}
+				return full( );
+			}
+
+			/// @brief Pass the batch to consumer as ( Columns const &, std::size_t
+			/// row_count ) when it has any rows, then start a new batch.  The
+			/// buffers are reused, consumer must copy what it keeps
+			template<typename Consumer>
+			void flush( Consumer &&consumer ) {
+				if( m_size > 0 ) {
+					(void)consumer( std::as_const( m_columns ), m_size );
+				}
+				clear( );
+			}
+
+			/// @brief Discard the rows of the batch and keep the capacity
+			void clear( ) {
+				std::apply(
+				  []( auto &...columns ) {
+					  ( columns.clear( ), ... );
+				  },
+				  m_columns );
+				m_size = 0;
+			}
+		};
+
+		/// @brief Parse a JSON Lines document of T into Arrow columns, passing each
+		/// batch of batch_size rows and the final partial batch to on_batch
+		/// @tparam T A class mapped with a json_member_list
+		/// @tparam Columns A tuple of columns, one per member of T
+		/// @param json_lines_doc A JSON Lines document with an object of T per line
+		/// @param batch_size The number of rows in a full batch
+		/// @param on_batch Called with ( Columns const &, std::size_t row_count )
+		/// @return The number of rows parsed
+		/// @throws daw::json::json_exception
+		template<typename T, typename Columns = arrow_columns_t<T>,
+		         typename Consumer>
+		std::size_t json_lines_to_arrow( daw::string_view json_lines_doc,
+		                                 std::size_t batch_size,
+		                                 Consumer &&on_batch ) {
+			auto builder = json_arrow_batch_builder<T, Columns>( batch_size );
+			auto first = json_lines_iterator<T>( json_lines_doc );
+			auto const last = json_lines_iterator<T>( );
+			std::size_t row_count = 0;
+			while( builder.fill( first, last ) ) {
+				row_count += builder.size( );
+				builder.flush( on_batch );
+			}
+			row_count += builder.size( );
+			builder.flush( on_batch );
+			return row_count;
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -0,0 +1,139 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_json_link.h"
+#include "impl/daw_json_assert.h"
+
+#include <daw/stdinc/move_fwd_exch.h>
+
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+/***
+ * Struct of arrays parsing.  An array of mapped classes is parsed into one
+ * column per member of the json_member_list and the class itself is never
+ * constructed.  This suits analytics that scan a few members of many objects.
+ */
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			template<typename MemberList>
+			struct json_columns;
+
+			template<typename... JsonMembers>
+			struct json_columns<json_member_list<JsonMembers...>> {
+				using type = std::tuple<std::vector<json_result_t<JsonMembers>>...>;
+			};
+		} // namespace json_details
+
+		/***
+		 * The default columns of T, a std::vector of each member's parse result in
+		 * the order of the json_member_list
+		 * @tparam T A class mapped with a json_member_list
+		 */
+		template<typename T>
+		using json_columns_t =
+		  typename json_details::json_columns<json_data_contract_trait_t<T>>::type;
+
+		/// @brief Parse an array of T and append the members of each element to
+		/// columns
+		/// @tparam T A class mapped with a json_member_list
+		/// @tparam Columns A tuple-like with a container supporting emplace_back
+		/// per member of T, in the order of the json_member_list
+		/// @param json_data JSON string data containing an array of T
+		/// @param columns The columns to append to
+		/// @throws daw::json::json_exception
+		template<typename T, typename String, typename Columns,
+		         auto... PolicyFlags>
+		constexpr void
+		append_json_columns( String &&json_data, Columns &columns,
+		                     options::parse_flags_t<PolicyFlags...> ) {
+			static_assert(
+			  json_details::is_json_member_list_v<json_data_contract_trait_t<T>>,
+			  "Only classes mapped with a json_member_list can be parsed to columns" );
+			using json_member = json_details::json_deduced_type<T>;
+			auto parse_state = json_details::make_document_parse_state<
+			  options::parse_flags_t<PolicyFlags...>::value>( json_data );
+			using ParseState = decltype( parse_state );
+			parse_state.trim_left( );
+			daw_json_ensure( parse_state.is_opening_bracket_checked( ),
+			                 ErrorReason::InvalidArrayStart, parse_state );
+			parse_state.remove_prefix( );
+			parse_state.trim_left( );
+
+			while( parse_state.has_more( ) and parse_state.front( ) != ']' ) {
+				json_data_contract_trait_t<T>::template parse_to_columns<json_member>(
+				  parse_state, columns );
+				daw_json_assert_weak( parse_state.has_more( ) and
+				                        parse_state.is_at_next_array_element( ),
+				                      ErrorReason::UnexpectedEndOfData, parse_state );
+				parse_state.move_next_member_or_end( );
+			}
+			daw_json_ensure( parse_state.has_more( ),
+			                 ErrorReason::UnexpectedEndOfData, parse_state );
+			parse_state.remove_prefix( );
+			parse_state.trim_left( );
+			if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
+				daw_json_ensure( parse_state.empty( ), ErrorReason::InvalidEndOfValue,
+				                 parse_state );
+			}
+		}
+
+		/// @brief Parse an array of T and append the members of each element to
+		/// columns
+		/// @tparam T A class mapped with a json_member_list
+		/// @tparam Columns A tuple-like with a container supporting emplace_back
+		/// per member of T, in the order of the json_member_list
+		/// @param json_data JSON string data containing an array of T
+		/// @param columns The columns to append to
+		/// @throws daw::json::json_exception
+		template<typename T, typename String, typename Columns>
+		constexpr void append_json_columns( String &&json_data, Columns &columns ) {
+			append_json_columns<T>( DAW_FWD( json_data ), columns,
+			                        options::parse_flags<> );
+		}
+
+		/// @brief Parse an array of T into a column per member of T, without
+		/// constructing any T
+		/// @tparam T A class mapped with a json_member_list
+		/// @tparam Columns A tuple-like with a container supporting emplace_back
+		/// per member of T, in the order of the json_member_list
+		/// @param json_data JSON string data containing an array of T
+		/// @return The columns of the members of T
+		/// @throws daw::json::json_exception
+		template<typename T, typename Columns = json_columns_t<T>,
+		         typename String, auto... PolicyFlags>
+		[[nodiscard]] constexpr Columns
+		from_json_columns( String &&json_data,
+		                   options::parse_flags_t<PolicyFlags...> flags ) {
+			auto result = Columns{ };
+			append_json_columns<T>( DAW_FWD( json_data ), result, flags );
+			return result;
+		}
+
+		/// @brief Parse an array of T into a column per member of T, without
+		/// constructing any T
+		/// @tparam T A class mapped with a json_member_list
+		/// @tparam Columns A tuple-like with a container supporting emplace_back
+		/// per member of T, in the order of the json_member_list
+		/// @param json_data JSON string data containing an array of T
+		/// @return The columns of the members of T
+		/// @throws daw::json::json_exception
+		template<typename T, typename Columns = json_columns_t<T>,
+		         typename String>
+		[[nodiscard]] constexpr Columns from_json_columns( String &&json_data ) {
+			return from_json_columns<T, Columns>( DAW_FWD( json_data ),
+			                                      options::parse_flags<> );
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
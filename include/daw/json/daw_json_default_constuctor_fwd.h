@@ -11,12 +11,15 @@
 #include "impl/version.h"
 
 #include "concepts/daw_nullable_value.h"
+#include "impl/daw_json_container_appender.h"
+#include "impl/daw_json_req_helper.h"
 
 #include <daw/cpp_17.h>
 #include <daw/daw_attributes.h>
 #include <daw/daw_move.h>
 #include <daw/daw_traits.h>
 
+#include <cstddef>
 #include <memory>
 #include <type_traits>
 
@@ -31,7 +34,17 @@ namespace daw::json {
 			inline constexpr bool should_list_construct_v =
 			  not std::is_constructible_v<T, Args...> and
 			  daw::traits::is_list_constructible_v<T, Args...>;
-		}
+
+			DAW_JSON_MAKE_REQ_TRAIT( has_reserve_v, std::declval<T &>( ).reserve(
+			                                          std::declval<std::size_t>( ) ) );
+		} // namespace json_details
+
+		/// @brief The number of elements that a container is about to be
+		/// constructed from.  It is passed after the iterators when the parser has
+		/// counted them first, so that the storage can be allocated once
+		struct container_size_hint {
+			std::size_t value;
+		};
 		/// @brief Default Constructor for a type.  It accounts for aggregate types
 		/// and uses brace construction for them
 		/// @tparam T type to construct
@@ -56,6 +69,23 @@ namespace daw::json {
 			  noexcept( std::is_nothrow_constructible_v<T, Args...> ) {
 				return T{ DAW_FWD( args )... };
 			}
+
+			/// @brief Construct an empty container, reserve room for hint.value
+			/// elements and append the range to it
+			template<typename Iterator, typename Last, typename U = T DAW_JSON_ENABLEIF(
+			  json_details::has_reserve_v<U> )>
+			DAW_JSON_REQUIRES( json_details::has_reserve_v<U> )
+			[[nodiscard]] DAW_ATTRIB_INLINE DAW_JSON_CPP23_STATIC_CALL_OP constexpr T
+			operator( )( Iterator first, Last last, container_size_hint hint )
+			  DAW_JSON_CPP23_STATIC_CALL_OP_CONST {
+				auto result = T( );
+				result.reserve( hint.value );
+				auto out = basic_appender<T>( result );
+				for( ; first != last; ++first ) {
+					out = *first;
+				}
+				return result;
+			}
 		};
 
 		/// @brief Default constructor for nullable types.
@@ -464,10 +464,37 @@ namespace daw::json {
 				}
 			};
 
+			// The parent of a class/array is left on it until the child's range
+			// ends.  Skipping the child up front would rescan every nested value
+			// once per level of depth
+			auto const step_over_child = [&]( stack_value_t const &child ) {
+				auto &parent = parent_stack.back( ).value.first;
+				if( not parent ) {
+					return;
+				}
+				auto const &child_state = child.value.first.get_raw_state( );
+				if( not child_state.has_more( ) ) {
+					// The child was moved to its end by the handler
+					++parent;
+					return;
+				}
+				auto parent_state = parent.get_raw_state( );
+				parent_state.first = child_state.first + 1;
+				parent_state.move_next_member_or_end( );
+				parent = iterator( parent_state );
+			};
+
 			auto const process_range = [&]( stack_value_t v ) {
 				if( v.value.first != v.value.second ) {
 					auto jv = *v.value.first;
-					++v.value.first;
+					switch( jv.value.type( ) ) {
+					case JsonBaseParseTypes::Class:
+					case JsonBaseParseTypes::Array:
+						break;
+					default:
+						++v.value.first;
+						break;
+					}
 					parent_stack.push_back( std::move( v ) );
 					process_value( std::move( jv ) );
 				} else {
@@ -507,6 +534,9 @@ namespace daw::json {
 						}
 					} break;
 					}
+					if( not parent_stack.empty( ) ) {
+						step_over_child( v );
+					}
 				}
 			};
 
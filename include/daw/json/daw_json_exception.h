@@ -87,7 +87,8 @@ namespace daw::json {
 			ExpectedTokenNotFound,
 			UnexpectedJSONVariantType,
 			TrailingComma,
-			AttemptToCallOpStarOnConstIterator
+			AttemptToCallOpStarOnConstIterator,
+			MissingStringPool
 		};
 
 		constexpr std::string_view reason_message( ErrorReason er ) {
@@ -189,6 +190,8 @@ namespace daw::json {
 				return "Trailing comma"sv;
 			case ErrorReason::AttemptToCallOpStarOnConstIterator:
 				return "Use of operator*( ) on const iterator";
+			case ErrorReason::MissingStringPool:
+				return "Parsing an interned_string requires a json_string_pool_scope";
 			}
 			DAW_UNREACHABLE( );
 		}
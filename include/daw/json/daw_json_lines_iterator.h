@@ -85,6 +85,28 @@ namespace daw::json {
 				                                 element_type::expected_type>( tmp );
 			}
 
+			/// @brief Parse the current element and append each of its members to
+			/// their column, without constructing value_type
+			/// @pre good( ) returns true
+			/// @tparam Columns A tuple-like with a container supporting emplace_back
+			/// per member of the json_member_list of value_type
+			/// @param columns The columns to append to
+			template<typename Columns>
+			constexpr void parse_to_columns( Columns &columns ) const {
+				static_assert(
+				  json_details::is_json_member_list_v<
+				    json_data_contract_trait_t<value_type>>,
+				  "Only classes mapped with a json_member_list can be parsed to "
+				  "columns" );
+				daw_json_assert_weak( m_state.has_more( ),
+				                      ErrorReason::UnexpectedEndOfData, m_state );
+
+				auto tmp = m_state;
+				json_data_contract_trait_t<value_type>::template parse_to_columns<
+				  element_type>( tmp, columns );
+				m_can_skip = tmp.first;
+			}
+
 			/// @brief A dereferencable value proxy holding the result of operator* .
 			/// This is for compatibility with the Iterator concepts and should be
 			/// avoided
@@ -10,8 +10,14 @@
 
 #include "impl/version.h"
 
+#include "daw_from_json_fwd.h"
+#include "impl/daw_json_lazy_value.h"
 #include "impl/daw_json_link_types_fwd.h"
+#include "impl/daw_json_parse_into.h"
+#include "impl/daw_json_preserved_value.h"
 #include "impl/daw_json_serialize_impl.h"
+#include "impl/daw_json_string_pool.h"
+#include "impl/daw_json_tag_switcher.h"
 #include "impl/daw_json_traits.h"
 
 #include <daw/daw_attributes.h>
@@ -78,6 +84,19 @@ namespace daw::json {
 			template<typename Constructor>
 			using result_type =
 			  json_details::json_class_parse_result_t<Constructor, JsonMembers...>;
+
+			/// @brief The number of mapped members
+			static constexpr std::size_t member_count = sizeof...( JsonMembers );
+
+			/// @brief The position of the member named name in the member list,
+			/// or member_count when it is not mapped
+			[[nodiscard]] static constexpr std::size_t
+			find_member( daw::string_view name ) {
+				std::size_t result = 0;
+				(void)( ( JsonMembers::name == name ? true : ( ++result, false ) ) or
+				        ... );
+				return result;
+			}
 			/**
 			 *
 			 * Parse JSON data and construct a C++ class.  This is used by parse_value
@@ -100,6 +119,65 @@ namespace daw::json {
 				return json_details::parse_json_class<JsonClass, JsonMembers...>(
 				  parse_state, std::index_sequence_for<JsonMembers...>{ } );
 			}
+
+			/**
+			 * Parse JSON data and construct a C++ class from only the members in
+			 * projection.  The other members are skipped and value initialized.
+			 * @tparam T The result of parsing json_class
+			 * @tparam ParseState Input range type
+			 * @param parse_state JSON data to parse
+			 * @param projection The members to parse, see json_projection
+			 * @return A T object
+			 */
+			template<typename JsonClass, bool /*KnownBounds*/, typename ParseState,
+			         typename Projection>
+			[[nodiscard]] DAW_ATTRIB_INLINE static constexpr json_details::
+			  json_result_t<JsonClass>
+			  parse_to_class( ParseState &parse_state,
+			                  Projection const &projection ) {
+
+				static_assert( json_details::is_no_name_v<JsonClass> );
+				static_assert( json_details::is_a_json_type_v<JsonClass> );
+				static_assert( json_details::has_json_data_contract_trait_v<
+				                 json_details::json_result_t<JsonClass>>,
+				               "Unexpected type" );
+				return json_details::parse_json_class<JsonClass, JsonMembers...>(
+				  parse_state, std::index_sequence_for<JsonMembers...>{ }, projection );
+			}
+
+			/**
+			 * Parse JSON data of a class and append each member to its own column
+			 * without constructing the class
+			 * @tparam JsonClass The json_class mapping of the class
+			 * @tparam ParseState Input range type
+			 * @tparam Columns A tuple of containers with emplace_back, one per member
+			 * @param parse_state JSON data to parse
+			 * @param columns The columns to append the members to
+			 */
+			template<typename JsonClass, typename ParseState, typename Columns>
+			DAW_ATTRIB_INLINE static constexpr void
+			parse_to_columns( ParseState &parse_state, Columns &columns ) {
+				static_assert( json_details::is_a_json_type_v<JsonClass> );
+				json_details::parse_json_class_columns<JsonClass, JsonMembers...>(
+				  parse_state, columns, std::index_sequence_for<JsonMembers...>{ } );
+			}
+
+			/**
+			 * Parse JSON data of a class into the members of an existing object,
+			 * reusing the storage they already have
+			 * @tparam JsonClass The json_class mapping of the class
+			 * @tparam ParseState Input range type
+			 * @param parse_state JSON data to parse
+			 * @param target The object to parse into, to_json_data must return
+			 * references to its members
+			 */
+			template<typename JsonClass, typename ParseState, typename T>
+			DAW_ATTRIB_INLINE static constexpr void
+			parse_into_class( ParseState &parse_state, T &target ) {
+				static_assert( json_details::is_a_json_type_v<JsonClass> );
+				json_details::parse_json_class_into<JsonClass, JsonMembers...>(
+				  parse_state, target, std::index_sequence_for<JsonMembers...>{ } );
+			}
 		};
 		///
 		/// Deduce the json type mapping based on common types and types already
@@ -1915,6 +1993,87 @@ namespace daw::json {
 		  T, json_base::json_raw<json_details::unwrapped_t<T>>, NullableType,
 		  Constructor>;
 
+		namespace json_details {
+			template<typename T>
+			struct preserved_value_constructor {
+				[[nodiscard]] constexpr json_preserved_value<T>
+				operator( )( char const *ptr, std::size_t sz ) const {
+					auto const source = std::string_view( ptr, sz );
+					return json_preserved_value<T>( from_json<T>( source ), source );
+				}
+			};
+		} // namespace json_details
+
+		/***
+		 * json_preserved parses the member as T and keeps the JSON text it came
+		 * from.  When serialized and the value has not been modified, the
+		 * original text is written back verbatim with a single buffer copy. This
+		 * makes read/modify/write round trips cheap when only a small part of a
+		 * document changes.  See json_preserved_value
+		 * @tparam Name json member name
+		 * @tparam T type the member is parsed to, must be mapped or deducible
+		 */
+		template<JSONNAMETYPE Name, typename T>
+		using json_preserved =
+		  json_raw<Name, json_preserved_value<T>,
+		           json_details::preserved_value_constructor<T>>;
+
+		/***
+		 * json_preserved parses the value as T and keeps the JSON text it came
+		 * from.  When serialized and the value has not been modified, the
+		 * original text is written back verbatim with a single buffer copy.
+		 * See json_preserved_value
+		 * @tparam T type the value is parsed to, must be mapped or deducible
+		 */
+		template<typename T>
+		using json_preserved_no_name =
+		  json_base::json_raw<json_preserved_value<T>,
+		                      json_details::preserved_value_constructor<T>>;
+
+		template<typename T>
+		struct json_data_contract<json_preserved_value<T>> {
+			using type = json_type_alias<json_preserved_no_name<T>>;
+		};
+
+		namespace json_details {
+			template<typename T>
+			struct lazy_value_constructor {
+				[[nodiscard]] constexpr json_lazy_value<T>
+				operator( )( char const *ptr, std::size_t sz ) const {
+					return json_lazy_value<T>( std::string_view( ptr, sz ) );
+				}
+			};
+		} // namespace json_details
+
+		/***
+		 * json_lazy skips the member while parsing the class and keeps its JSON
+		 * text.  It is parsed as T on first access and the result is cached.
+		 * When serialized and the value has not been modified, the original text
+		 * is written back verbatim.  This avoids the cost of parsing members that
+		 * are rarely read.  See json_lazy_value
+		 * @tparam Name json member name
+		 * @tparam T type the member is parsed to, must be mapped or deducible
+		 */
+		template<JSONNAMETYPE Name, typename T>
+		using json_lazy = json_raw<Name, json_lazy_value<T>,
+		                           json_details::lazy_value_constructor<T>>;
+
+		/***
+		 * json_lazy skips the value while parsing and keeps its JSON text. It is
+		 * parsed as T on first access and the result is cached.  See
+		 * json_lazy_value
+		 * @tparam T type the value is parsed to, must be mapped or deducible
+		 */
+		template<typename T>
+		using json_lazy_no_name =
+		  json_base::json_raw<json_lazy_value<T>,
+		                      json_details::lazy_value_constructor<T>>;
+
+		template<typename T>
+		struct json_data_contract<json_lazy_value<T>> {
+			using type = json_type_alias<json_lazy_no_name<T>>;
+		};
+
 		template<json_options_t PolicyFlags, typename Allocator>
 		struct json_data_contract<basic_json_value<PolicyFlags, Allocator>> {
 			using type = json_type_alias<
@@ -0,0 +1,448 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_json_link.h"
+#include "impl/daw_json_assert.h"
+#include "impl/daw_json_parse_into.h"
+#include "impl/daw_json_req_helper.h"
+
+#include <daw/daw_traits.h>
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+/***
+ * RFC 7396 JSON Merge Patch support for mapped classes.  Patches are produced
+ * by walking the json_member_list of two values and only the members that
+ * differ are written.  Nested mapped classes are diffed recursively, all other
+ * values, including arrays, are replaced as a whole.
+ */
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			DAW_JSON_MAKE_REQ_TRAIT( is_merge_patch_equality_comparable_v,
+			                         static_cast<bool>( std::declval<T const &>( ) ==
+			                                            std::declval<T const &>( ) ) );
+
+			template<typename JsonMember>
+			using merge_patch_base_member_t = typename daw::conditional_t<
+			  is_json_nullable_v<JsonMember>,
+			  ident_trait<json_nullable_member_type_t, JsonMember>,
+			  daw::traits::identity<JsonMember>>::type;
+
+			template<typename MemberList>
+			struct merge_patch_class;
+
+			/***
+			 * Can T be diffed/patched member by member.  This requires a
+			 * json_member_list mapping
+			 */
+			template<typename T>
+			DAW_CONSTEVAL bool is_merge_patch_class( ) {
+				if constexpr( has_json_data_contract_trait_v<T> ) {
+					return is_json_member_list_v<json_data_contract_trait_t<T>>;
+				} else {
+					return false;
+				}
+			}
+
+			template<typename JsonMember>
+			inline constexpr bool is_merge_patch_class_member_v =
+			  merge_patch_base_member_t<JsonMember>::expected_type ==
+			    JsonParseTypes::Class and
+			  is_merge_patch_class<
+			    json_result_t<merge_patch_base_member_t<JsonMember>>>( );
+
+			template<typename T>
+			[[nodiscard]] constexpr bool merge_patch_differs( T const &lhs,
+			                                                  T const &rhs ) {
+				return merge_patch_class<json_data_contract_trait_t<T>>::differs(
+				  json_data_contract<T>::to_json_data( lhs ),
+				  json_data_contract<T>::to_json_data( rhs ) );
+			}
+
+			template<typename JsonMember, typename U>
+			[[nodiscard]] constexpr bool merge_patch_member_differs( U const &lhs,
+			                                                         U const &rhs ) {
+				if constexpr( is_json_nullable_v<JsonMember> ) {
+					bool const lhs_has_value = concepts::nullable_value_has_value( lhs );
+					if( lhs_has_value != concepts::nullable_value_has_value( rhs ) ) {
+						return true;
+					}
+					if( not lhs_has_value ) {
+						return false;
+					}
+					return merge_patch_member_differs<
+					  json_nullable_member_type_t<JsonMember>>(
+					  concepts::nullable_value_read( lhs ),
+					  concepts::nullable_value_read( rhs ) );
+				} else if constexpr( is_merge_patch_equality_comparable_v<U> ) {
+					return not static_cast<bool>( lhs == rhs );
+				} else if constexpr( is_merge_patch_class_member_v<JsonMember> ) {
+					return merge_patch_differs( lhs, rhs );
+				} else {
+					// No operator== available, compare the serialized forms
+					return to_json<JsonMember>( lhs ) != to_json<JsonMember>( rhs );
+				}
+			}
+
+			template<typename T, typename WritableType,
+			         json_options_t SerializationOptions>
+			constexpr void serialize_merge_patch(
+			  serialization_policy<WritableType, SerializationOptions> &it,
+			  T const &lhs, T const &rhs ) {
+				merge_patch_class<json_data_contract_trait_t<T>>::serialize(
+				  it, json_data_contract<T>::to_json_data( lhs ),
+				  json_data_contract<T>::to_json_data( rhs ) );
+			}
+
+			template<typename JsonMember, typename WritableType,
+			         json_options_t SerializationOptions, typename U>
+			constexpr void merge_patch_member_to_json_str(
+			  bool &is_first,
+			  serialization_policy<WritableType, SerializationOptions> &it,
+			  U const &lhs, U const &rhs ) {
+				if( not merge_patch_member_differs<JsonMember>( lhs, rhs ) ) {
+					return;
+				}
+				if( not is_first ) {
+					it.put( ',' );
+				}
+				it.next_member( );
+				is_first = false;
+				it.write( '"', JsonMember::name, "\":", it.space );
+
+				if constexpr( is_json_nullable_v<JsonMember> ) {
+					if( not concepts::nullable_value_has_value( rhs ) ) {
+						// null removes the member from the target
+						it.write( "null" );
+						return;
+					}
+					if constexpr( is_merge_patch_class_member_v<JsonMember> ) {
+						if( concepts::nullable_value_has_value( lhs ) ) {
+							serialize_merge_patch( it, concepts::nullable_value_read( lhs ),
+							                       concepts::nullable_value_read( rhs ) );
+							return;
+						}
+					}
+				} else if constexpr( is_merge_patch_class_member_v<JsonMember> ) {
+					serialize_merge_patch( it, lhs, rhs );
+					return;
+				}
+				it = member_to_string<JsonMember>( std::move( it ), rhs );
+			}
+
+			/***
+			 * Parse the patch value of a member, merging it into the existing value
+			 * when both are classes
+			 */
+			template<typename JsonMember, typename U, json_options_t PolicyFlags,
+			         typename Allocator>
+			[[nodiscard]] constexpr json_result_t<JsonMember> merge_patch_member(
+			  U const &current,
+			  basic_json_value<PolicyFlags, Allocator> const &patch ) {
+				using result_t = json_result_t<JsonMember>;
+				if( not patch ) {
+					// Not part of the patch, keep the current value
+					return result_t( current );
+				}
+				if constexpr( is_merge_patch_class_member_v<JsonMember> ) {
+					if( patch.is_class( ) ) {
+						using class_t =
+						  json_result_t<merge_patch_base_member_t<JsonMember>>;
+						if constexpr( is_json_nullable_v<JsonMember> ) {
+							if constexpr( concepts::is_nullable_value_constructible_v<
+							                result_t, class_t> ) {
+								if( concepts::nullable_value_has_value( current ) ) {
+									auto value =
+									  class_t( concepts::nullable_value_read( current ) );
+									merge_patch_class<
+									  json_data_contract_trait_t<class_t>>::apply( value, patch );
+									return concepts::nullable_value_traits<result_t>{ }(
+									  concepts::construct_nullable_with_value,
+									  std::move( value ) );
+								}
+							}
+						} else {
+							auto value = class_t( current );
+							merge_patch_class<json_data_contract_trait_t<class_t>>::apply(
+							  value, patch );
+							return value;
+						}
+					}
+				}
+				auto state = patch.get_raw_state( );
+				return parse_value<without_name<JsonMember>, false,
+				                   JsonMember::expected_type>( state );
+			}
+
+			/***
+			 * Merge the patch value of a member into the existing value.  Classes
+			 * are merged recursively, all other values are parsed into the member
+			 * with parse_value_into so that the storage it has is reused
+			 */
+			template<typename JsonMember, typename U, json_options_t PolicyFlags,
+			         typename Allocator>
+			constexpr void merge_patch_member_into(
+			  U &current, basic_json_value<PolicyFlags, Allocator> const &patch ) {
+				if( not patch ) {
+					// Not part of the patch, keep the current value
+					return;
+				}
+				if constexpr( is_merge_patch_class_member_v<JsonMember> ) {
+					if( patch.is_class( ) ) {
+						using class_t =
+						  json_result_t<merge_patch_base_member_t<JsonMember>>;
+						using class_patch_t =
+						  merge_patch_class<json_data_contract_trait_t<class_t>>;
+						if constexpr( is_json_nullable_v<JsonMember> ) {
+							if( concepts::nullable_value_has_value( current ) ) {
+								class_patch_t::apply(
+								  as_mutable( concepts::nullable_value_read( current ) ),
+								  patch );
+								return;
+							}
+						} else {
+							class_patch_t::apply( current, patch );
+							return;
+						}
+					}
+				}
+				auto state = patch.get_raw_state( );
+				parse_value_into<without_name<JsonMember>, false>( state, current );
+			}
+
+			template<typename... JsonMembers>
+			struct merge_patch_class<json_member_list<JsonMembers...>> {
+				template<typename Tuple, std::size_t... Is>
+				[[nodiscard]] static constexpr bool
+				differs_impl( Tuple const &lhs, Tuple const &rhs,
+				              std::index_sequence<Is...> ) {
+					using std::get;
+					return ( merge_patch_member_differs<JsonMembers>( get<Is>( lhs ),
+					                                                  get<Is>( rhs ) ) or
+					         ... or false );
+				}
+
+				template<typename Tuple>
+				[[nodiscard]] static constexpr bool differs( Tuple const &lhs,
+				                                             Tuple const &rhs ) {
+					static_assert(
+					  std::tuple_size_v<Tuple> == sizeof...( JsonMembers ),
+					  "The method to_json_data in the json_data_contract does not match "
+					  "the mapping.  The number of members is not the same." );
+					return differs_impl( lhs, rhs,
+					                     std::index_sequence_for<JsonMembers...>{ } );
+				}
+
+				template<typename WritableType, json_options_t SerializationOptions,
+				         typename Tuple, std::size_t... Is>
+				static constexpr void serialize_impl(
+				  serialization_policy<WritableType, SerializationOptions> &it,
+				  Tuple const &lhs, Tuple const &rhs, std::index_sequence<Is...> ) {
+					using std::get;
+					it.put( '{' );
+					it.add_indent( );
+					bool is_first = true;
+					(void)is_first;
+					( merge_patch_member_to_json_str<JsonMembers>( is_first, it,
+					                                               get<Is>( lhs ),
+					                                               get<Is>( rhs ) ),
+					  ... );
+					it.del_indent( );
+					if( not is_first ) {
+						if constexpr( serialization_policy<WritableType,
+						                                   SerializationOptions>::
+						                output_trailing_comma ==
+						              options::OutputTrailingComma::Yes ) {
+							it.put( ',' );
+						}
+						it.next_member( );
+					}
+					it.put( '}' );
+				}
+
+				template<typename WritableType, json_options_t SerializationOptions,
+				         typename Tuple>
+				static constexpr void
+				serialize( serialization_policy<WritableType, SerializationOptions> &it,
+				           Tuple const &lhs, Tuple const &rhs ) {
+					static_assert(
+					  std::tuple_size_v<Tuple> == sizeof...( JsonMembers ),
+					  "The method to_json_data in the json_data_contract does not match "
+					  "the mapping.  The number of members is not the same." );
+					serialize_impl( it, lhs, rhs,
+					                std::index_sequence_for<JsonMembers...>{ } );
+				}
+
+				[[nodiscard]] static constexpr std::size_t
+				find_member_index( std::string_view name ) {
+					constexpr auto names = std::array<daw::string_view,
+					                                  sizeof...( JsonMembers )>{
+					  daw::string_view( std::data( JsonMembers::name ),
+					                    std::size( JsonMembers::name ) )... };
+					for( std::size_t n = 0; n < names.size( ); ++n ) {
+						if( names[n] == name ) {
+							return n;
+						}
+					}
+					return names.size( );
+				}
+
+				template<typename T, typename Tuple, typename Patches,
+				         std::size_t... Is>
+				[[nodiscard]] static constexpr T
+				apply_impl( Tuple const &current, Patches const &patches,
+				            std::index_sequence<Is...> ) {
+					using std::get;
+					using constructor_t = json_class_constructor_t<T, use_default>;
+					// Braced init to guarantee the members are evaluated in order
+					return std::apply(
+					  constructor_t{ },
+					  std::tuple<json_result_t<JsonMembers>...>{
+					    merge_patch_member<JsonMembers>( get<Is>( current ),
+					                                     patches[Is] )... } );
+				}
+
+				template<typename Tuple, typename Patches, std::size_t... Is>
+				static constexpr void apply_in_place( Tuple const &members,
+				                                      Patches const &patches,
+				                                      std::index_sequence<Is...> ) {
+					using std::get;
+					( merge_patch_member_into<JsonMembers>(
+					    as_mutable( get<Is>( members ) ), patches[Is] ),
+					  ... );
+				}
+
+				/***
+				 * Merge a patch into value.  Members that are not in the patch are
+				 * not touched.  When to_json_data returns references to the members
+				 * the patched ones are updated in place, otherwise the class is
+				 * rebuilt via its constructor
+				 */
+				template<typename T, json_options_t PolicyFlags, typename Allocator>
+				static constexpr void
+				apply( T &value,
+				       basic_json_value<PolicyFlags, Allocator> const &patch ) {
+					daw_json_ensure( patch.is_class( ), ErrorReason::InvalidClassStart,
+					                 patch.get_raw_state( ) );
+
+					// One pass over the patch, it may list members in any order
+					auto patches = std::array<basic_json_value<PolicyFlags, Allocator>,
+					                          sizeof...( JsonMembers )>{ };
+					for( auto const &jp : patch ) {
+						daw_json_ensure( jp.name.has_value( ),
+						                 ErrorReason::MissingMemberName );
+						auto const idx = find_member_index( *jp.name );
+						if( idx < patches.size( ) ) {
+							patches[idx] = jp.value;
+						}
+					}
+					if constexpr( has_member_references<T>( ) ) {
+						auto const members = json_data_contract<T>::to_json_data( value );
+						apply_in_place( members, patches,
+						                std::index_sequence_for<JsonMembers...>{ } );
+					} else {
+						auto const &current = json_data_contract<T>::to_json_data( value );
+						value = apply_impl<T>( current, patches,
+						                       std::index_sequence_for<JsonMembers...>{ } );
+					}
+				}
+			};
+		} // namespace json_details
+
+		/***
+		 * Serialize the difference between two values as an RFC 7396 JSON Merge
+		 * Patch.  Only members that differ are written, nested mapped classes are
+		 * diffed recursively and members that became null are written as null.
+		 * @tparam T A class with a json_member_list mapping
+		 * @param old_value the value the receiver currently has
+		 * @param new_value the value the receiver should have after the patch
+		 * @param it The writable output to write the patch to
+		 * @return it as is with ref qual or as a value if rvalue ref
+		 */
+		template<typename T, typename WritableType,
+		         auto... PolicyFlags DAW_JSON_ENABLEIF(
+		           concepts::is_writable_output_type_v<
+		             daw::remove_cvref_t<WritableType>> )>
+		DAW_JSON_REQUIRES(
+		  concepts::is_writable_output_type_v<daw::remove_cvref_t<WritableType>> )
+		constexpr daw::rvalue_to_value_t<WritableType> to_json_diff(
+		  T const &old_value, T const &new_value, WritableType &&it,
+		  options::output_flags_t<PolicyFlags...> = options::output_flags<> ) {
+			static_assert( json_details::is_merge_patch_class<T>( ),
+			               "T must be mapped with a json_member_list" );
+			using output_t = daw::rvalue_to_value_t<WritableType>;
+			if constexpr( std::is_pointer_v<daw::remove_cvref_t<WritableType>> ) {
+				daw_json_ensure( it != nullptr, ErrorReason::NullOutputIterator );
+			}
+			auto out_it =
+			  json_details::apply_policy_flags<output_t, PolicyFlags...>( it );
+			json_details::serialize_merge_patch( out_it, old_value, new_value );
+			return out_it.get( );
+		}
+
+		/***
+		 * Serialize the difference between two values as an RFC 7396 JSON Merge
+		 * Patch.  An unchanged value results in {}
+		 * @tparam T A class with a json_member_list mapping
+		 * @param old_value the value the receiver currently has
+		 * @param new_value the value the receiver should have after the patch
+		 * @return A std::string with the JSON Merge Patch
+		 */
+		template<typename T, auto... PolicyFlags>
+		[[nodiscard]] std::string
+		to_json_diff( T const &old_value, T const &new_value,
+		              options::output_flags_t<PolicyFlags...> flgs =
+		                options::output_flags<> ) {
+			auto result = std::string( );
+			(void)to_json_diff( old_value, new_value, result, flgs );
+			return result;
+		}
+
+		/***
+		 * Apply an RFC 7396 JSON Merge Patch to value.  The patch is parsed
+		 * directly against the mapping of T, members not in the patch keep their
+		 * current value and nested mapped classes are merged recursively.  A null
+		 * member clears nullable members and is an error for non-nullable ones.
+		 * When to_json_data returns references to the members, as from_json_into
+		 * requires, only the patched members are written and their storage is
+		 * reused.  Members are then patched in order, so when the patch is
+		 * invalid the members before the error have already been updated.
+		 * Otherwise the class is rebuilt with the unpatched members copied
+		 * @tparam T A class with a json_member_list mapping
+		 * @param value The value to update
+		 * @param json_patch JSON Merge Patch document, must be an object
+		 * @throws daw::json::json_exception
+		 */
+		template<typename T, typename String, auto... PolicyFlags>
+		constexpr void
+		apply_merge_patch( T &value, String &&json_patch,
+		                   options::parse_flags_t<PolicyFlags...> =
+		                     options::parse_flags<> ) {
+			static_assert( json_details::is_merge_patch_class<T>( ),
+			               "T must be mapped with a json_member_list" );
+			static_assert(
+			  json_details::is_string_view_like_v<String>,
+			  "String type must have a be a contiguous range of Characters" );
+			auto const patch =
+			  basic_json_value<options::parse_flags_t<PolicyFlags...>::value>(
+			    daw::string_view( std::data( json_patch ), std::size( json_patch ) ) );
+			json_details::merge_patch_class<json_data_contract_trait_t<T>>::apply(
+			  value, patch );
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -152,6 +152,16 @@ namespace daw::json {
 				/// default: no
 				///
 				enum class ExcludeSpecialEscapes : unsigned { no, yes }; // 1bit
+
+				///
+				/// @brief The buffer passed to from_json is mutable and can be
+				/// overwritten. Escaped strings are unescaped in place, inside their
+				/// own quotes, and string_view-like results can refer to them. The
+				/// buffer no longer holds the original document after parsing.
+				///
+				/// default: no
+				///
+				enum class InPlaceUnescape : unsigned { no, yes }; // 1bit
 			} // namespace parser_options
 		}   // namespace options
 	}     // namespace DAW_JSON_VER
@@ -0,0 +1,53 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_json_link_types.h"
+#include "impl/daw_json_parser_diagnostics.h"
+
+#include <tuple>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/***
+		 * Allows dumping the parser statistics, e.g.
+		 * to_json_array( get_parser_stats( ) )
+		 */
+		template<>
+		struct json_data_contract<json_parser_stats> {
+			static constexpr char const type_name[] = "type_name";
+			static constexpr char const classes_parsed[] = "classes_parsed";
+			static constexpr char const out_of_order_members[] =
+			  "out_of_order_members";
+			static constexpr char const unknown_members[] = "unknown_members";
+			static constexpr char const slow_path_strings[] = "slow_path_strings";
+			static constexpr char const strtod_fallbacks[] = "strtod_fallbacks";
+			static constexpr char const array_regrowths[] = "array_regrowths";
+
+			using type = json_member_list<
+			  json_string_raw<type_name, std::string_view>,
+			  json_number<classes_parsed, std::size_t>,
+			  json_number<out_of_order_members, std::size_t>,
+			  json_number<unknown_members, std::size_t>,
+			  json_number<slow_path_strings, std::size_t>,
+			  json_number<strtod_fallbacks, std::size_t>,
+			  json_number<array_regrowths, std::size_t>>;
+
+			[[nodiscard]] static constexpr auto
+			to_json_data( json_parser_stats const &value ) {
+				return std::forward_as_tuple(
+				  value.type_name, value.classes_parsed, value.out_of_order_members,
+				  value.unknown_members, value.slow_path_strings,
+				  value.strtod_fallbacks, value.array_regrowths );
+			}
+		};
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
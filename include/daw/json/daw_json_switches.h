@@ -57,8 +57,9 @@
 // std::is_constant_evaluated( ) is available in
 // <daw/daw_is_constant_evaluated.h>
 
-// Show extra diagnostic information like unmapped members when parsing
-// by defining DAW_JSON_PARSER_DIAGNOSTICS
+// Count the slow paths taken while parsing, like unmapped or out of order
+// members, per mapped type by defining DAW_JSON_PARSER_DIAGNOSTICS.  See
+// get_parser_stats( ) in <daw/json/daw_json_parser_stats.h>
 
 // DAW_CAN_CONSTANT_EVAL is used to test if we are in a constant expression
 #if defined( DAW_HAS_GCC_LIKE )
@@ -11,6 +11,7 @@
 #include "version.h"
 
 #include "daw_json_assert.h"
+#include "daw_json_parser_diagnostics.h"
 
 #include <daw/daw_attributes.h>
 #include <daw/daw_cpp_feature_check.h>
@@ -36,6 +37,7 @@ namespace daw::json {
 			  parse_with_strtod( char const *first, char const *last ) {
 				static_assert( std::is_floating_point_v<Real>,
 				               "Unexpected type passed to parse_with_strtod" );
+				DAW_JSON_COUNT_PARSER_EVENT( strtod_fallback );
 #if defined( DAW_JSON_USE_STRTOD )
 				(void)last;
 				char **end = nullptr;
@@ -11,6 +11,7 @@
 #include "version.h"
 
 #include "daw_json_assert.h"
+#include "daw_json_parser_diagnostics.h"
 #include <daw/json/concepts/daw_nullable_value.h>
 #include <daw/json/daw_json_default_constuctor_fwd.h>
 
@@ -18,8 +19,10 @@
 #include <daw/daw_move.h>
 #include <daw/daw_scope_guard.h>
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
+#include <functional>
 #include <iterator>
 #include <type_traits>
 #include <unordered_map>
@@ -139,9 +142,28 @@ namespace daw::json {
 					result.reserve( reserve_amount );
 					result.assign_range( json_details::iter_range_t{
 					  std::move( first ), std::move( last ) } );
+					if( result.size( ) > reserve_amount ) {
+						DAW_JSON_COUNT_PARSER_EVENT( array_regrowth );
+					}
 					return result;
 				}
 			}
+
+			/// @brief Reserve room for hint.value elements before appending the
+			/// range
+			template<typename Iterator, typename Last>
+			DAW_ATTRIB_INLINE
+			  DAW_JSON_CPP23_STATIC_CALL_OP DAW_JSON_CX_VECTOR std::vector<T, Alloc>
+			  operator( )( Iterator first, Last last, container_size_hint hint,
+			               Alloc const &alloc = Alloc{ } )
+			    DAW_JSON_CPP23_STATIC_CALL_OP_CONST {
+				auto result = std::vector<T, Alloc>( alloc );
+				result.reserve( hint.value );
+				for( ; first != last; ++first ) {
+					result.push_back( *first );
+				}
+				return result;
+			}
 			DAW_JSON_CPP23_STATIC_CALL_OP_ENABLE_WARNING
 		};
 
@@ -176,9 +198,28 @@ namespace daw::json {
 					// Lets use a WAG and go for a 4k page size
 					result.reserve( reserve_amount );
 					result.assign( std::move( first ), std::move( last ) );
+					if( result.size( ) > reserve_amount ) {
+						DAW_JSON_COUNT_PARSER_EVENT( array_regrowth );
+					}
 					return result;
 				}
 			}
+
+			/// @brief Reserve room for hint.value elements before appending the
+			/// range
+			template<typename Iterator, typename Last>
+			DAW_ATTRIB_INLINE
+			  DAW_JSON_CPP23_STATIC_CALL_OP DAW_JSON_CX_VECTOR std::vector<T, Alloc>
+			  operator( )( Iterator first, Last last, container_size_hint hint,
+			               Alloc const &alloc = Alloc{ } )
+			    DAW_JSON_CPP23_STATIC_CALL_OP_CONST {
+				auto result = std::vector<T, Alloc>( alloc );
+				result.reserve( hint.value );
+				for( ; first != last; ++first ) {
+					result.push_back( *first );
+				}
+				return result;
+			}
 			DAW_JSON_CPP23_STATIC_CALL_OP_ENABLE_WARNING
 		};
 #endif
@@ -212,7 +253,57 @@ namespace daw::json {
 				return std::unordered_map<Key, T, Hash, CompareEqual, Alloc>(
 				  first, last, count, Hash{ }, CompareEqual{ }, alloc );
 			}
+
+			/// @brief Start with hint.value buckets so that appending the range does
+			/// not rehash
+			template<typename Iterator>
+			DAW_ATTRIB_INLINE DAW_JSON_CPP23_STATIC_CALL_OP
+			  std::unordered_map<Key, T, Hash, CompareEqual, Alloc>
+			  operator( )( Iterator first, Iterator last, container_size_hint hint,
+			               Alloc const &alloc = Alloc{ } )
+			    DAW_JSON_CPP23_STATIC_CALL_OP_CONST {
+				return std::unordered_map<Key, T, Hash, CompareEqual, Alloc>(
+				  first, last, hint.value, Hash{ }, CompareEqual{ }, alloc );
+			}
+			DAW_JSON_CPP23_STATIC_CALL_OP_ENABLE_WARNING
+		};
+
+		/***
+		 * A Constructor for json_key_value that makes a flat map.  The members
+		 * are appended to a sequence of key/value pairs, e.g.
+		 * std::vector<std::pair<Key, Value>>, that is sorted by key once they are
+		 * all parsed.  Lookups can then use a binary search like std::lower_bound
+		 * @tparam Container A sequence container of pairs
+		 * @tparam Compare The ordering of the keys
+		 */
+		template<typename Container, typename Compare = std::less<>>
+		struct sorted_key_value_constructor {
+			DAW_JSON_CPP23_STATIC_CALL_OP_DISABLE_WARNING
+			template<typename Iterator, typename Last>
+			[[nodiscard]] DAW_ATTRIB_INLINE DAW_JSON_CPP23_STATIC_CALL_OP Container
+			operator( )( Iterator first,
+			             Last last ) DAW_JSON_CPP23_STATIC_CALL_OP_CONST {
+				return sort_by_key( default_constructor<Container>{ }(
+				  std::move( first ), std::move( last ) ) );
+			}
+
+			template<typename Iterator, typename Last>
+			[[nodiscard]] DAW_ATTRIB_INLINE DAW_JSON_CPP23_STATIC_CALL_OP Container
+			operator( )( Iterator first, Last last, container_size_hint hint )
+			  DAW_JSON_CPP23_STATIC_CALL_OP_CONST {
+				return sort_by_key( default_constructor<Container>{ }(
+				  std::move( first ), std::move( last ), hint ) );
+			}
 			DAW_JSON_CPP23_STATIC_CALL_OP_ENABLE_WARNING
+
+		private:
+			static Container sort_by_key( Container &&c ) {
+				std::sort( std::begin( c ), std::end( c ),
+				           []( auto const &lhs, auto const &rhs ) {
+					           return Compare{ }( lhs.first, rhs.first );
+				           } );
+				return std::move( c );
+			}
 		};
 
 		/// @brief Default constructor for readable nullable types.
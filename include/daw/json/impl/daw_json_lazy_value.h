@@ -0,0 +1,165 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include "../daw_from_json_fwd.h"
+
+#include <daw/stdinc/move_fwd_exch.h>
+
+#include <optional>
+#include <string_view>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/***
+		 * A value that is only parsed from its JSON text the first time it is
+		 * accessed, the result is cached.  Until it is modified, serialization
+		 * writes the original text back with a single buffer copy whether or not
+		 * it has been parsed.  Mutating it via mutable_value( ) or assignment
+		 * forgets the source text and serialization falls back to the mapping of
+		 * T.
+		 * The source text is not owned, the JSON document must outlive the value
+		 * until it is parsed and modified.  The cache is not synchronized, the
+		 * first access must not race with other accesses.  When parsed as part of
+		 * a document, the source text is parsed with that document's options,
+		 * other than its Allocator, otherwise the default options are used.
+		 * @tparam T The parsed type, must be mapped or deducible
+		 */
+		template<typename T>
+		class json_lazy_value {
+		public:
+			using value_type = T;
+			/// @brief Parses the source text on first access
+			using parse_function_t = T ( * )( std::string_view );
+
+		private:
+			std::string_view m_source{ };
+			parse_function_t m_parse = &parse_with_default_options;
+			mutable std::optional<T> m_value{ };
+			bool m_is_dirty = false;
+
+			[[nodiscard]] static constexpr T
+			parse_with_default_options( std::string_view source ) {
+				return from_json<T>( source );
+			}
+
+		public:
+
+			/// @brief A default constructed T, it will always be serialized from
+			/// value
+			constexpr json_lazy_value( )
+			  : m_value( std::in_place )
+			  , m_is_dirty( true ) {}
+
+			/// @brief Construct from the JSON text of the value, it is parsed on
+			/// first access
+			explicit constexpr json_lazy_value( std::string_view source )
+			  : m_source( source ) {}
+
+			/// @brief Construct from the JSON text of the value and the function
+			/// that parses it on first access
+			constexpr json_lazy_value( std::string_view source,
+			                           parse_function_t parse )
+			  : m_source( source )
+			  , m_parse( parse ) {}
+
+			/// @brief Construct from a value without any source text. It will
+			/// always be serialized from value
+			explicit constexpr json_lazy_value( T const &value )
+			  : m_value( value )
+			  , m_is_dirty( true ) {}
+
+			/// @brief Construct from a value without any source text. It will
+			/// always be serialized from value
+			explicit constexpr json_lazy_value( T &&value )
+			  : m_value( std::move( value ) )
+			  , m_is_dirty( true ) {}
+
+			constexpr json_lazy_value &operator=( T const &value ) {
+				m_value = value;
+				mark_dirty( );
+				return *this;
+			}
+
+			constexpr json_lazy_value &operator=( T &&value ) {
+				m_value = std::move( value );
+				mark_dirty( );
+				return *this;
+			}
+
+			/// @brief The value, parsing the source text if this is the first
+			/// access
+			[[nodiscard]] constexpr T const &value( ) const {
+				if( not m_value ) {
+					m_value.emplace( m_parse( m_source ) );
+				}
+				return *m_value;
+			}
+
+			[[nodiscard]] constexpr T const &operator*( ) const {
+				return value( );
+			}
+
+			[[nodiscard]] constexpr T const *operator->( ) const {
+				return &value( );
+			}
+
+			/// @brief Access the value for modification.  This parses the value if
+			/// needed and marks it dirty, even if it is not changed
+			[[nodiscard]] constexpr T &mutable_value( ) {
+				(void)value( );
+				mark_dirty( );
+				return *m_value;
+			}
+
+			/// @brief The source text is no longer used for serialization.  The
+			/// value is parsed first so that it is not lost
+			constexpr void mark_dirty( ) {
+				(void)value( );
+				m_is_dirty = true;
+				m_source = std::string_view{ };
+			}
+
+			/// @brief Has the source text been parsed yet
+			[[nodiscard]] constexpr bool is_parsed( ) const {
+				return m_value.has_value( );
+			}
+
+			/// @brief Is value serialized from T's mapping instead of the source
+			/// text
+			[[nodiscard]] constexpr bool is_dirty( ) const {
+				return m_is_dirty;
+			}
+
+			/// @brief The original JSON text of the value. Empty when dirty
+			[[nodiscard]] constexpr std::string_view source( ) const {
+				return m_source;
+			}
+		};
+
+		namespace json_details {
+			template<typename>
+			inline constexpr bool is_json_lazy_value_v = false;
+
+			template<typename T>
+			inline constexpr bool is_json_lazy_value_v<json_lazy_value<T>> = true;
+
+			/***
+			 * Construct a json_lazy_value from the raw JSON text of a member without
+			 * parsing it.  It is parsed with the default options, the parser does
+			 * not use this and keeps the document's options, see
+			 * parse_value_lazy
+			 */
+			template<typename T>
+			struct lazy_value_constructor;
+		} // namespace json_details
+	}   // namespace DAW_JSON_VER
+} // namespace daw::json
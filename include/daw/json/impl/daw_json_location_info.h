@@ -12,6 +12,7 @@
 
 #include "daw_json_assert.h"
 #include "daw_json_find_result.h"
+#include "daw_json_parser_diagnostics.h"
 #include "daw_murmur3.h"
 
 #include <daw/algorithms/daw_algorithm_adjacent_find.h>
@@ -26,11 +27,6 @@
 #include <cstddef>
 #include <daw/stdinc/data_access.h>
 
-#if defined( DAW_JSON_PARSER_DIAGNOSTICS )
-#include <cmath>
-#include <iostream>
-#endif
-
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
 		namespace json_details {
@@ -235,11 +231,9 @@ namespace daw::json {
 						daw_json_assert_weak( name_pos < std::size( locations ),
 						                      ErrorReason::UnknownMember, parse_state );
 					} else {
-#if defined( DAW_JSON_PARSER_DIAGNOSTICS )
-						std::cerr << "DEBUG: Unknown member '" << name << '\n';
-#endif
 						if( name_pos >= std::size( locations ) ) {
 							// This is not a member we are concerned with
+							DAW_JSON_COUNT_PARSER_EVENT( unknown_member );
 							(void)skip_value( parse_state );
 							parse_state.move_next_member_or_end( );
 							continue;
@@ -249,15 +243,7 @@ namespace daw::json {
 						locations[pos].set_range( parse_state );
 						break;
 					} else {
-#if defined( DAW_JSON_PARSER_DIAGNOSTICS )
-						std::cerr << "DEBUG:	Out of order member '"
-						          << locations.names[name_pos].name
-						          << "' found, looking for '" << locations.names[pos].name
-						          << ". It is "
-						          << std::abs( static_cast<long long>( pos ) -
-						                       static_cast<long long>( name_pos ) )
-						          << " members ahead in constructor\n";
-#endif
+						DAW_JSON_COUNT_PARSER_EVENT( out_of_order_member );
 						// We are out of order, store position for later
 						// OLDTODO:	use type knowledge to speed up skip
 						// OLDTODO:	on skipped classes see if way to store
@@ -292,6 +278,45 @@ namespace daw::json {
 					  locations[pos].template get_range<ParseState>( ), known };
 				}
 			}
+
+			/***
+			 * Move the parser forward until the member at pos has been seen,
+			 * recording the range of every mapped member skipped on the way.  Unlike
+			 * find_class_member, the member at pos is skipped too so that all the
+			 * recorded ranges have known bounds.
+			 * @tparam pos position of the member in locations to search for
+			 * @param parse_state Current JSON data, positioned at the next member name
+			 * @param locations members location and names
+			 */
+			template<std::size_t pos, AllMembersMustExist must_exist, std::size_t N,
+			         typename ParseState, bool B, typename CharT>
+			DAW_ATTRIB_INLINE static constexpr void
+			skip_to_class_member( ParseState &parse_state,
+			                      locations_info_t<N, CharT, B> &locations ) {
+				parse_state.trim_left_unchecked( );
+				while( nsc_and(
+				  locations[pos].missing( ),
+				  ( not parse_state.empty( ) and parse_state.front( ) != '}' ) ) ) {
+					auto const name = parse_name( parse_state );
+					auto const name_pos =
+					  locations.template find_name<ParseState::expect_long_strings, 0>(
+					    name );
+					if constexpr( must_exist == AllMembersMustExist::yes ) {
+						daw_json_assert_weak( name_pos < std::size( locations ),
+						                      ErrorReason::UnknownMember, parse_state );
+					} else {
+						if( name_pos >= std::size( locations ) ) {
+							// This is not a member we are concerned with
+							DAW_JSON_COUNT_PARSER_EVENT( unknown_member );
+							(void)skip_value( parse_state );
+							parse_state.move_next_member_or_end( );
+							continue;
+						}
+					}
+					locations[name_pos].set_range( skip_value( parse_state ) );
+					parse_state.move_next_member_or_end( );
+				}
+			}
 		} // namespace json_details
 	} // namespace DAW_JSON_VER
 } // namespace daw::json
@@ -24,7 +24,9 @@
 #include <daw/daw_traits.h>
 
 #include <cstddef>
+#include <tuple>
 #include <type_traits>
+#include <utility>
 
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
@@ -80,23 +82,226 @@ namespace daw::json {
 				  parse_state );
 			}
 
+			/***
+			 * The tag member of a json_tagged_variant class member, or void.  Tags
+			 * of ordered members and of nullable variants are not searched for
+			 * while parsing the class and are void too.
+			 */
+			template<typename JsonMember, typename = void>
+			struct variant_tag_member {
+				using type = void;
+			};
+
+			template<typename JsonMember>
+			struct variant_tag_member<
+			  JsonMember,
+			  std::enable_if_t<( JsonMember::expected_type ==
+			                     JsonParseTypes::VariantTagged ) and
+			                   not is_an_ordered_member_v<
+			                     typename JsonMember::tag_member>>> {
+				using type = typename JsonMember::tag_member;
+			};
+
+			template<typename JsonMember>
+			using variant_tag_member_t = typename variant_tag_member<JsonMember>::type;
+
+			template<typename JsonMember>
+			DAW_CONSTEVAL daw::string_view variant_tag_name( ) {
+				if constexpr( std::is_void_v<variant_tag_member_t<JsonMember>> ) {
+					return daw::string_view{ };
+				} else {
+					return variant_tag_member_t<JsonMember>::name;
+				}
+			}
+
+			/***
+			 * Is the tag of the member at Idx neither a member of the class nor the
+			 * tag of a prior member.  These tags get their own location so that they
+			 * are recorded while scanning the class.
+			 */
+			template<std::size_t Idx, typename... JsonMembers>
+			DAW_CONSTEVAL bool is_unmapped_variant_tag( ) {
+				constexpr daw::string_view tag_name =
+				  variant_tag_name<daw::traits::nth_type<Idx, JsonMembers...>>( );
+				if constexpr( tag_name.empty( ) ) {
+					return false;
+				} else {
+					daw::string_view const names[] = { JsonMembers::name... };
+					daw::string_view const tag_names[] = {
+					  variant_tag_name<JsonMembers>( )... };
+					for( std::size_t n = 0; n < sizeof...( JsonMembers ); ++n ) {
+						if( names[n] == tag_name or
+						    ( n < Idx and tag_names[n] == tag_name ) ) {
+							return false;
+						}
+					}
+					return true;
+				}
+			}
+
+			template<typename... JsonMembers, std::size_t... Is>
+			auto class_location_members( std::index_sequence<Is...> )
+			  -> decltype( std::tuple_cat(
+			    std::declval<std::tuple<JsonMembers...>>( ),
+			    std::declval<daw::conditional_t<
+			      is_unmapped_variant_tag<Is, JsonMembers...>( ),
+			      std::tuple<variant_tag_member_t<
+			        daw::traits::nth_type<Is, JsonMembers...>>>,
+			      std::tuple<>>>( )... ) );
+
+			/***
+			 * The members of a json_member_list class followed by the tags of its
+			 * json_tagged_variant members that are not mapped in the class
+			 */
+			template<typename... JsonMembers>
+			using class_location_members_t =
+			  decltype( class_location_members<JsonMembers...>(
+			    std::index_sequence_for<JsonMembers...>{ } ) );
+
+			template<typename ParseState, typename... LocationMembers>
+			DAW_ATTRIB_FLATINLINE static inline DAW_JSON_MAKE_LOC_INFO_CONSTEVAL auto
+			make_class_locations_info( std::tuple<LocationMembers...> const * ) {
+				return make_locations_info<ParseState, LocationMembers...>( );
+			}
+
+			inline constexpr std::size_t no_variant_tag_position =
+			  static_cast<std::size_t>( -1 );
+
+			/***
+			 * The position in the class locations of the tag of JsonMember, or
+			 * no_variant_tag_position when JsonMember is not a json_tagged_variant
+			 */
+			template<typename JsonMember, typename... LocationMembers>
+			DAW_CONSTEVAL std::size_t
+			variant_tag_position( std::tuple<LocationMembers...> const * ) {
+				constexpr daw::string_view tag_name = variant_tag_name<JsonMember>( );
+				if constexpr( tag_name.empty( ) ) {
+					return no_variant_tag_position;
+				} else {
+					daw::string_view const names[] = { LocationMembers::name... };
+					for( std::size_t n = 0; n < sizeof...( LocationMembers ); ++n ) {
+						if( names[n] == tag_name ) {
+							return n;
+						}
+					}
+					return no_variant_tag_position;
+				}
+			}
+
+			/***
+			 * Parse a json_tagged_variant class member whose tag comes after it in
+			 * the class mapping and has not been seen yet.  The class is scanned
+			 * forward to the tag, recording the location of the variant and of
+			 * every member skipped on the way, so that the class is only scanned
+			 * once.
+			 */
+			template<std::size_t member_position, typename JsonMember,
+			         AllMembersMustExist must_exist, std::size_t TagPosition,
+			         typename ParseState, std::size_t N, typename CharT, bool B>
+			[[nodiscard]] static constexpr json_result_t<JsonMember>
+			parse_tagged_variant_class_member(
+			  ParseState &parse_state, locations_info_t<N, CharT, B> &locations,
+			  bool known ) {
+				using tag_member = typename JsonMember::tag_member;
+				using switcher_t = typename JsonMember::switcher;
+
+				if( not known ) {
+					// The variant is at the front, skip it to get at the tag
+					locations[member_position].set_range( skip_value( parse_state ) );
+					parse_state.move_next_member_or_end( );
+				}
+				skip_to_class_member<TagPosition, must_exist>( parse_state, locations );
+
+				auto const get_range = [&]( std::size_t pos ) {
+					if constexpr( ParseState::has_allocator ) {
+						return locations[pos]
+						  .template get_range<ParseState>( )
+						  .with_allocator( parse_state );
+					} else {
+						return locations[pos].template get_range<ParseState>( );
+					}
+				};
+
+				auto loc = get_range( member_position );
+				daw_json_assert_weak(
+				  not loc.is_null( ),
+				  missing_member( std::string_view( std::data( JsonMember::name ),
+				                                    std::size( JsonMember::name ) ) ),
+				  parse_state );
+
+				// The tag can be a member of the class too and parsed again, see
+				// reread_parse_state_t
+				auto const tag_range = get_range( TagPosition );
+				auto tag_loc = reread_parse_state_t<ParseState>(
+				  tag_range.first, tag_range.last, tag_range.class_first,
+				  tag_range.class_last, tag_range.get_allocator( ) );
+				auto const index = [&] {
+					if constexpr( is_json_nullable_v<tag_member> ) {
+						if( tag_loc.is_null( ) ) {
+							return switcher_t{ }(
+							  parse_value_null<without_name<tag_member>, true>( tag_loc ) );
+						}
+					} else {
+						daw_json_assert_weak(
+						  not tag_loc.is_null( ),
+						  missing_member( std::string_view(
+						    std::data( tag_member::name ), std::size( tag_member::name ) ) ),
+						  parse_state );
+					}
+					return switcher_t{ }(
+					  parse_value<without_name<tag_member>, true,
+					              tag_member::expected_type>( tag_loc ) );
+				}( );
+				return parse_visit<json_result_t<JsonMember>,
+				                   typename JsonMember::json_elements::element_map_t>(
+				  index, loc );
+			}
+
+			/***
+			 * The projection used when all members of a class are parsed
+			 */
+			struct no_projection {
+				static constexpr bool is_complete = true;
+
+				[[nodiscard]] static constexpr bool contains( std::size_t ) {
+					return true;
+				}
+			};
+
 			///
 			///@brief Parse a member from a json_class
 			///@tparam member_position position in json_class member list
 			///@tparam JsonMember type description of member to parse
+			///@tparam LocationMembers the members that have a location, see
+			/// class_location_members_t
 			///@tparam N Number of members in json_class
 			///@tparam ParseState see IteratorRange
 			///@param locations location info for members
 			///@param parse_state JSON data
+			///@param projection members to parse, others are value initialized.
+			/// Members that are not default constructible are always parsed
 			///@return parsed value from JSON data
 			///
 			template<std::size_t member_position, typename JsonMember,
 			         AllMembersMustExist must_exist, bool NeedsClassPositions,
-			         typename ParseState, std::size_t N, typename CharT, bool B>
+			         typename LocationMembers, typename ParseState, std::size_t N,
+			         typename CharT, bool B, typename Projection>
 			[[nodiscard]] DAW_ATTRIB_FLATINLINE static constexpr json_result_t<
 			  JsonMember>
 			parse_class_member( ParseState &parse_state,
-			                    locations_info_t<N, CharT, B> &locations ) {
+			                    locations_info_t<N, CharT, B> &locations,
+			                    Projection const &projection ) {
+				if constexpr( not Projection::is_complete and
+				              std::is_default_constructible_v<
+				                json_result_t<JsonMember>> ) {
+					if( not projection.contains( member_position ) ) {
+						// Not part of the projection.  It is skipped like an unknown
+						// member when a later member is searched for
+						return json_result_t<JsonMember>{ };
+					}
+				} else {
+					(void)projection;
+				}
 				parse_state.move_next_member_or_end( );
 
 				daw_json_assert_weak(
@@ -107,6 +312,27 @@ namespace daw::json {
 				  parse_state, locations, is_json_nullable_v<JsonMember>,
 				  JsonMember::name );
 
+				constexpr std::size_t tag_position = variant_tag_position<JsonMember>(
+				  static_cast<LocationMembers const *>( nullptr ) );
+				// Finding the tag by re-scanning the class would read the members
+				// before it after they have been unescaped in place
+				static_assert( not ParseState::in_place_unescape or
+				                 tag_position == no_variant_tag_position or
+				                 tag_position > member_position,
+				               "With options::InPlaceUnescape the tag of a "
+				               "json_tagged_variant cannot be mapped before it" );
+				if constexpr( tag_position != no_variant_tag_position and
+				              tag_position > member_position ) {
+					// Tags that come before the variant are cheap to find by
+					// re-scanning, only search forward for the ones after it
+					if( ParseState::in_place_unescape or
+					    locations[tag_position].missing( ) ) {
+						return parse_tagged_variant_class_member<
+						  member_position, JsonMember, must_exist, tag_position>(
+						  parse_state, locations, known );
+					}
+				}
+
 				// If the member was found loc will have it's position
 				if( not known ) {
 					if constexpr( NeedsClassPositions ) {
@@ -180,9 +406,10 @@ namespace daw::json {
 			/// and return that to the members parser when needed.
 			///
 			template<typename JsonClass, typename... JsonMembers, typename ParseState,
-			         std::size_t... Is>
+			         std::size_t... Is, typename Projection = no_projection>
 			[[nodiscard]] DAW_ATTRIB_INLINE constexpr json_result_t<JsonClass>
-			parse_json_class( ParseState &parse_state, std::index_sequence<Is...> ) {
+			parse_json_class( ParseState &parse_state, std::index_sequence<Is...>,
+			                  Projection const &projection = Projection{ } ) {
 				static_assert( is_a_json_type_v<JsonClass> );
 				using T = json_result_t<JsonClass>;
 				using Constructor = json_constructor_t<JsonClass>;
@@ -191,6 +418,12 @@ namespace daw::json {
 				  daw::constant<( all_json_members_must_exist_v<T, ParseState>
 				                    ? AllMembersMustExist::yes
 				                    : AllMembersMustExist::no )>;
+				DAW_JSON_PARSER_STATS_SCOPE( T );
+				// Members left out of a projection may remain after the last member
+				// parsed, they are skipped without checking for unknown members
+				using is_exact_class = std::bool_constant<(
+				  all_json_members_must_exist_v<T, ParseState> and
+				  Projection::is_complete )>;
 
 				parse_state.trim_left( );
 				// TODO, use member name
@@ -203,9 +436,9 @@ namespace daw::json {
 				parse_state.trim_left( );
 
 				if constexpr( sizeof...( JsonMembers ) == 0 ) {
+					(void)projection;
 					// Clang-CL with MSVC has issues if we don't do empties this way
-					class_cleanup_now<all_json_members_must_exist_v<T, ParseState>>(
-					  parse_state, old_class_pos );
+					class_cleanup_now<is_exact_class::value>( parse_state, old_class_pos );
 
 					if constexpr( should_construct_explicitly_v<Constructor, T,
 					                                            ParseState> ) {
@@ -219,12 +452,16 @@ namespace daw::json {
 					  ( must_be_class_member_v<typename JsonMembers::without_name> or
 					    ... ) )>;
 
+					// The tags of json_tagged_variant members are given a location too,
+					// so they can be found without scanning the class again
+					using location_members_t = class_location_members_t<JsonMembers...>;
 #if defined( DAW_JSON_BUGFIX_MSVC_KNOWN_LOC_ICE_003 )
-					auto known_locations =
-					  make_locations_info<ParseState, JsonMembers...>( );
+					auto known_locations = make_class_locations_info<ParseState>(
+					  static_cast<location_members_t const *>( nullptr ) );
 #else
-					auto known_locations = DAW_AS_CONSTANT(
-					  ( make_locations_info<ParseState, JsonMembers...>( ) ) );
+					auto known_locations =
+					  DAW_AS_CONSTANT( ( make_class_locations_info<ParseState>(
+					    static_cast<location_members_t const *>( nullptr ) ) ) );
 #endif
 
 					if constexpr( is_pinned_type_v<json_result_t<JsonClass>> ) {
@@ -232,7 +469,7 @@ namespace daw::json {
 						/// on NRVO. This requires on_exit_success that on some platforms
 						/// can cost a bunch because it checks std::uncaught_exceptions
 						auto const run_after_parse = daw::on_exit_success( [&] {
-							class_cleanup_now<all_json_members_must_exist_v<T, ParseState>>(
+							class_cleanup_now<is_exact_class::value>(
 							  parse_state, old_class_pos );
 						} );
 						(void)run_after_parse;
@@ -241,34 +478,38 @@ namespace daw::json {
 						                                            ParseState> ) {
 							return T{ parse_class_member<
 							  Is, daw::traits::nth_type<Is, JsonMembers...>,
-							  must_exist::value, NeedClassPositions::value>(
-							  parse_state, known_locations )... };
+							  must_exist::value, NeedClassPositions::value,
+							  location_members_t>(
+							  parse_state, known_locations, projection )... };
 						} else {
 							return construct_value_tp<T, Constructor>(
 							  parse_state, fwd_pack{ parse_class_member<
 							                 Is, daw::traits::nth_type<Is, JsonMembers...>,
-							                 must_exist::value, NeedClassPositions::value>(
-							                 parse_state, known_locations )... } );
+							                 must_exist::value, NeedClassPositions::value,
+							                 location_members_t>( parse_state, known_locations,
+							                                      projection )... } );
 						}
 					} else {
 						if constexpr( should_construct_explicitly_v<Constructor, T,
 						                                            ParseState> ) {
 							auto result = T{ parse_class_member<
 							  Is, daw::traits::nth_type<Is, JsonMembers...>,
-							  must_exist::value, NeedClassPositions::value>(
-							  parse_state, known_locations )... };
+							  must_exist::value, NeedClassPositions::value,
+							  location_members_t>(
+							  parse_state, known_locations, projection )... };
 
-							class_cleanup_now<all_json_members_must_exist_v<T, ParseState>>(
+							class_cleanup_now<is_exact_class::value>(
 							  parse_state, old_class_pos );
 							return result;
 						} else {
 							auto result = construct_value_tp<T, Constructor>(
 							  parse_state, fwd_pack{ parse_class_member<
 							                 Is, daw::traits::nth_type<Is, JsonMembers...>,
-							                 must_exist::value, NeedClassPositions::value>(
-							                 parse_state, known_locations )... } );
+							                 must_exist::value, NeedClassPositions::value,
+							                 location_members_t>( parse_state, known_locations,
+							                                      projection )... } );
 
-							class_cleanup_now<all_json_members_must_exist_v<T, ParseState>>(
+							class_cleanup_now<is_exact_class::value>(
 							  parse_state, old_class_pos );
 							return result;
 						}
@@ -276,6 +517,98 @@ namespace daw::json {
 				}
 			}
 
+			/***
+			 * The mapping member JsonMember is parsed with for its column.  A column
+			 * can declare template<typename JsonMember, typename ParseState> using
+			 * json_member_t to be appended another representation of the value, e.g.
+			 * a string with its escapes still in it that is unescaped into the
+			 * column's own storage with the document's policy
+			 */
+			template<typename Column, typename JsonMember, typename ParseState,
+			         typename = void>
+			struct column_json_member {
+				using type = JsonMember;
+			};
+
+			template<typename Column, typename JsonMember, typename ParseState>
+			struct column_json_member<
+			  Column, JsonMember, ParseState,
+			  std::void_t<
+			    typename Column::template json_member_t<JsonMember, ParseState>>> {
+				using type =
+				  typename Column::template json_member_t<JsonMember, ParseState>;
+			};
+
+			template<std::size_t Idx, typename Columns, typename ParseState,
+			         typename... JsonMembers>
+			using nth_column_json_member_t = typename column_json_member<
+			  std::tuple_element_t<Idx, Columns>,
+			  daw::traits::nth_type<Idx, JsonMembers...>, ParseState>::type;
+
+			///
+			/// @brief Parse a class the same way as parse_json_class, but append the
+			/// value of each member to the column at its position in columns
+			/// instead of constructing the class.  The whole row is parsed before
+			/// any column is appended to, so an error leaves the columns the same
+			/// length
+			///
+			template<typename JsonClass, typename... JsonMembers, typename ParseState,
+			         typename Columns, std::size_t... Is>
+			DAW_ATTRIB_INLINE constexpr void
+			parse_json_class_columns( ParseState &parse_state, Columns &columns,
+			                          std::index_sequence<Is...> ) {
+				static_assert( is_a_json_type_v<JsonClass> );
+				using T = json_result_t<JsonClass>;
+				static_assert( has_json_data_contract_trait_v<T>, "Unexpected type" );
+				static_assert( std::tuple_size_v<Columns> == sizeof...( JsonMembers ),
+				               "There must be one column per member" );
+				using must_exist =
+				  daw::constant<( all_json_members_must_exist_v<T, ParseState>
+				                    ? AllMembersMustExist::yes
+				                    : AllMembersMustExist::no )>;
+				DAW_JSON_PARSER_STATS_SCOPE( T );
+
+				parse_state.trim_left( );
+				daw_json_assert_weak( parse_state.is_opening_brace_checked( ),
+				                      ErrorReason::InvalidClassStart, parse_state );
+
+				auto const old_class_pos = parse_state.get_class_position( );
+				parse_state.set_class_position( );
+				parse_state.remove_prefix( );
+				parse_state.trim_left( );
+
+				if constexpr( sizeof...( JsonMembers ) == 0 ) {
+					(void)columns;
+				} else {
+					using NeedClassPositions = std::bool_constant<(
+					  ( must_be_class_member_v<typename JsonMembers::without_name> or
+					    ... ) )>;
+
+					using location_members_t = class_location_members_t<JsonMembers...>;
+#if defined( DAW_JSON_BUGFIX_MSVC_KNOWN_LOC_ICE_003 )
+					auto known_locations = make_class_locations_info<ParseState>(
+					  static_cast<location_members_t const *>( nullptr ) );
+#else
+					auto known_locations =
+					  DAW_AS_CONSTANT( ( make_class_locations_info<ParseState>(
+					    static_cast<location_members_t const *>( nullptr ) ) ) );
+#endif
+					// Braced initialization sequences the members left to right
+					auto row = std::tuple<json_result_t<nth_column_json_member_t<
+					  Is, Columns, ParseState, JsonMembers...>>...>{
+					  parse_class_member<
+					    Is,
+					    nth_column_json_member_t<Is, Columns, ParseState, JsonMembers...>,
+					    must_exist::value, NeedClassPositions::value, location_members_t>(
+					    parse_state, known_locations, no_projection{ } )... };
+					( (void)std::get<Is>( columns ).emplace_back(
+					    std::get<Is>( std::move( row ) ) ),
+					  ... );
+				}
+				class_cleanup_now<all_json_members_must_exist_v<T, ParseState>>(
+				  parse_state, old_class_pos );
+			}
+
 			///
 			/// @brief Parse to a class where the members are constructed from the
 			/// values of a JSON array. Often this is used for geometric types like
@@ -0,0 +1,411 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include "daw_json_assert.h"
+#include "daw_json_location_info.h"
+#include "daw_json_parse_class.h"
+#include "daw_json_parse_common.h"
+#include "daw_json_parse_std_string.h"
+#include "daw_json_parse_value.h"
+#include "daw_json_req_helper.h"
+#include "daw_json_skip.h"
+
+#include <daw/daw_consteval.h>
+#include <daw/daw_data_end.h>
+#include <daw/daw_traits.h>
+
+#include <cstddef>
+#include <iterator>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/***
+ * Parsing into an existing value.  Strings, containers, key/value maps and
+ * classes are assigned to in place so that the capacity they already have is
+ * reused, other values are parsed and assigned.
+ */
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			template<typename JsonMember, bool KnownBounds, typename ParseState,
+			         typename T>
+			constexpr void parse_value_into( ParseState &parse_state, T &target );
+
+			DAW_JSON_MAKE_REQ_TRAIT(
+			  is_reusable_sequence_v,
+			  ( (void)std::declval<T &>( ).emplace_back(
+			      std::declval<typename T::value_type>( ) ),
+			    (void)std::declval<T &>( ).erase( std::begin( std::declval<T &>( ) ),
+			                                      std::end( std::declval<T &>( ) ) ) ) );
+
+			DAW_JSON_MAKE_REQ_TRAIT(
+			  is_reusable_node_map_v,
+			  ( (void)std::declval<T &>( ).extract(
+			      std::declval<typename T::key_type const &>( ) ),
+			    (void)std::declval<T &>( ).find(
+			      std::declval<typename T::key_type const &>( ) )
+			      ->second ) );
+
+			template<typename Tuple, std::size_t... Is>
+			DAW_CONSTEVAL bool are_lvalue_references( std::index_sequence<Is...> ) {
+				return ( std::is_lvalue_reference_v<std::tuple_element_t<Is, Tuple>> and
+				         ... );
+			}
+
+			/***
+			 * Does to_json_data of T return references to the members of T.  They
+			 * are the only way to get at the members of a mapped class
+			 */
+			template<typename T>
+			DAW_CONSTEVAL bool has_member_references( ) {
+				if constexpr( has_json_to_json_data_v<T> ) {
+					using tuple_t = daw::remove_cvref_t<decltype(
+					  json_data_contract<T>::to_json_data( std::declval<T &>( ) ) )>;
+					return are_lvalue_references<tuple_t>(
+					  std::make_index_sequence<std::tuple_size_v<tuple_t>>{ } );
+				} else {
+					return false;
+				}
+			}
+
+			/***
+			 * Can the value of JsonMember be parsed into an existing T instead of
+			 * being constructed.  User constructors may do more than store the
+			 * parsed values, so only the default constructors qualify
+			 */
+			template<typename JsonMember, typename T>
+			DAW_CONSTEVAL bool can_parse_into( ) {
+				using result_t = json_result_t<JsonMember>;
+				if constexpr( not std::is_same_v<result_t, T> or
+				              is_json_nullable_v<JsonMember> or
+				              not has_json_member_constructor_v<JsonMember> ) {
+					return false;
+				} else if constexpr( not std::is_same_v<json_constructor_t<JsonMember>,
+				                                        default_constructor<T>> ) {
+					return false;
+				} else if constexpr( JsonMember::expected_type ==
+				                     JsonParseTypes::StringEscaped ) {
+					return can_single_allocation_string_v<T>;
+				} else if constexpr( JsonMember::expected_type ==
+				                     JsonParseTypes::Array ) {
+					if constexpr( is_reusable_sequence_v<T> ) {
+						return std::is_lvalue_reference_v<decltype(
+						  *std::begin( std::declval<T &>( ) ) )>;
+					} else {
+						return false;
+					}
+				} else if constexpr( JsonMember::expected_type ==
+				                     JsonParseTypes::KeyValue ) {
+					return is_reusable_node_map_v<T>;
+				} else if constexpr( JsonMember::expected_type ==
+				                     JsonParseTypes::Class ) {
+					if constexpr( is_json_member_list_v<json_data_contract_trait_t<T>> ) {
+						return has_member_references<T>( );
+					} else {
+						return false;
+					}
+				} else {
+					return false;
+				}
+			}
+
+			/// @brief to_json_data takes a const reference, the target is not const
+			/// so its members can be written through it
+			template<typename T>
+			DAW_ATTRIB_INLINE constexpr T &as_mutable( T const &value ) {
+				return const_cast<T &>( value );
+			}
+
+			template<typename JsonMember, bool KnownBounds, typename ParseState,
+			         typename String>
+			constexpr void parse_value_string_escaped_into( ParseState &parse_state,
+			                                                String &target ) {
+				if constexpr( not KnownBounds ) {
+					daw_json_ensure( not parse_state.empty( ),
+					                 ErrorReason::UnexpectedNull );
+				}
+				using AllowHighEightbits =
+				  std::bool_constant<JsonMember::eight_bit_mode !=
+				                     options::EightBitModes::DisallowHigh>;
+				auto parse_state2 =
+				  KnownBounds ? parse_state : skip_string( parse_state );
+				if constexpr( ParseState::in_place_unescape ) {
+					char const *const first = std::data( parse_state2 );
+					char const *last = daw::data_end( parse_state2 );
+					if( not AllowHighEightbits::value or
+					    needs_slow_path( parse_state2 ) ) {
+						last =
+						  parse_string_in_place<AllowHighEightbits::value>( parse_state2 );
+					}
+					target.assign( first, last );
+				} else {
+					if( not AllowHighEightbits::value or
+					    needs_slow_path( parse_state2 ) ) {
+						parse_string_known_stdstring_into<AllowHighEightbits::value, true>(
+						  parse_state2, target );
+					} else {
+						target.assign( std::data( parse_state2 ),
+						               daw::data_end( parse_state2 ) );
+					}
+				}
+			}
+
+			/***
+			 * Parse the array into the elements already in target, appending when
+			 * the array is longer and erasing those left over when it is shorter
+			 */
+			template<typename JsonMember, bool KnownBounds, typename ParseState,
+			         typename Container>
+			constexpr void parse_value_array_into( ParseState &parse_state,
+			                                       Container &target ) {
+				parse_state.trim_left( );
+				daw_json_assert_weak( parse_state.is_opening_bracket_checked( ),
+				                      ErrorReason::InvalidArrayStart, parse_state );
+				parse_state.remove_prefix( );
+				parse_state.trim_left_unchecked( );
+
+				using element_t = typename JsonMember::json_element_t;
+				using iterator_t =
+				  json_parse_array_iterator<JsonMember, ParseState,
+				                            can_be_random_iterator_v<KnownBounds>>;
+				auto pos = std::begin( target );
+				for( auto it = iterator_t( parse_state ); it != iterator_t( ); ++it ) {
+					daw_json_assert_weak( it.parse_state->has_more( ),
+					                      ErrorReason::UnexpectedEndOfData, parse_state );
+					if( pos != std::end( target ) ) {
+						parse_value_into<element_t, false>( *it.parse_state, *pos );
+						++pos;
+					} else {
+						target.emplace_back(
+						  parse_value<element_t, false, element_t::expected_type>(
+						    *it.parse_state ) );
+						pos = std::end( target );
+					}
+				}
+				target.erase( pos, std::end( target ) );
+			}
+
+			/***
+			 * Parse the members into the values of target with the same key, adding
+			 * the new keys.  When keys of target are not in the document, the
+			 * nodes of the ones that are are moved to a new map and the rest are
+			 * released
+			 */
+			template<typename JsonMember, bool KnownBounds, typename ParseState,
+			         typename Map>
+			constexpr void parse_value_keyvalue_into( ParseState &parse_state,
+			                                          Map &target ) {
+				daw_json_assert_weak( parse_state.is_opening_brace_checked( ),
+				                      ErrorReason::ExpectedKeyValueToStartWithBrace,
+				                      parse_state );
+				using key_t = typename JsonMember::json_key_t;
+				using value_t = typename JsonMember::json_element_t;
+				using iter_t =
+				  json_parse_kv_class_iterator<JsonMember, ParseState,
+				                               can_be_random_iterator_v<KnownBounds>>;
+
+				auto const class_state = parse_state;
+				parse_state.remove_prefix( );
+				parse_state.trim_left( );
+
+				// Reused for each member, only a key longer than all before it
+				// allocates
+				auto key = typename Map::key_type{ };
+				std::size_t member_count = 0;
+				for( auto it = iter_t( parse_state ); it != iter_t( ); ++it ) {
+					parse_value_into<key_t, false>( *it.parse_state, key );
+					name::name_parser::trim_end_of_name( *it.parse_state );
+					if( auto pos = target.find( key ); pos != std::end( target ) ) {
+						parse_value_into<value_t, false>( *it.parse_state, pos->second );
+					} else {
+						target.emplace(
+						  key, parse_value<value_t, false, value_t::expected_type>(
+						         *it.parse_state ) );
+					}
+					++member_count;
+				}
+				if( target.size( ) == member_count ) {
+					return;
+				}
+				auto kept = Map( target.get_allocator( ) );
+				auto keys_state = class_state;
+				keys_state.remove_prefix( );
+				keys_state.trim_left( );
+				for( auto it = iter_t( keys_state ); it != iter_t( ); ++it ) {
+					parse_value_into<key_t, false>( *it.parse_state, key );
+					name::name_parser::trim_end_of_name( *it.parse_state );
+					(void)skip_value( *it.parse_state );
+					if( auto node = target.extract( key ); node ) {
+						kept.insert( std::move( node ) );
+					}
+				}
+				target.swap( kept );
+			}
+
+			template<typename JsonMember, bool KnownBounds, typename ParseState,
+			         typename T>
+			constexpr void parse_value_class_into( ParseState &parse_state,
+			                                       T &target ) {
+				daw_json_assert_weak( parse_state.has_more( ),
+				                      ErrorReason::UnexpectedEndOfData, parse_state );
+				json_data_contract_trait_t<T>::template parse_into_class<JsonMember>(
+				  parse_state, target );
+				if constexpr( not KnownBounds ) {
+					parse_state.trim_left_checked( );
+				}
+			}
+
+			///
+			/// @brief Parse the value of JsonMember into target.  When it cannot be
+			/// parsed in place the parsed value is assigned to target
+			///
+			template<typename JsonMember, bool KnownBounds, typename ParseState,
+			         typename T>
+			constexpr void parse_value_into( ParseState &parse_state, T &target ) {
+				if constexpr( not can_parse_into<JsonMember, T>( ) ) {
+					target = parse_value<JsonMember, KnownBounds,
+					                     JsonMember::expected_type>( parse_state );
+				} else if constexpr( JsonMember::expected_type ==
+				                     JsonParseTypes::StringEscaped ) {
+					parse_value_string_escaped_into<JsonMember, KnownBounds>(
+					  parse_state, target );
+				} else if constexpr( JsonMember::expected_type ==
+				                     JsonParseTypes::Array ) {
+					parse_value_array_into<JsonMember, KnownBounds>( parse_state,
+					                                                 target );
+				} else if constexpr( JsonMember::expected_type ==
+				                     JsonParseTypes::KeyValue ) {
+					parse_value_keyvalue_into<JsonMember, KnownBounds>( parse_state,
+					                                                    target );
+				} else {
+					static_assert( JsonMember::expected_type == JsonParseTypes::Class );
+					parse_value_class_into<JsonMember, KnownBounds>( parse_state,
+					                                                 target );
+				}
+			}
+
+			///
+			/// @brief Parse a member of a json_class into the existing member
+			/// target.  See parse_class_member
+			///
+			template<std::size_t member_position, typename JsonMember,
+			         AllMembersMustExist must_exist, bool NeedsClassPositions,
+			         typename LocationMembers, typename ParseState, std::size_t N,
+			         typename CharT, bool B, typename T>
+			DAW_ATTRIB_FLATINLINE static constexpr void
+			parse_class_member_into( ParseState &parse_state,
+			                         locations_info_t<N, CharT, B> &locations,
+			                         T &target ) {
+				using member_t = without_name<JsonMember>;
+				if constexpr( not can_parse_into<member_t, T>( ) ) {
+					target =
+					  parse_class_member<member_position, JsonMember, must_exist,
+					                     NeedsClassPositions, LocationMembers>(
+					    parse_state, locations, no_projection{ } );
+				} else {
+					parse_state.move_next_member_or_end( );
+
+					daw_json_assert_weak(
+					  not parse_state.empty( ) and parse_state.is_at_next_class_member( ),
+					  ErrorReason::MissingMemberNameOrEndOfClass, parse_state );
+
+					auto [loc, known] = find_class_member<member_position, must_exist>(
+					  parse_state, locations, is_json_nullable_v<JsonMember>,
+					  JsonMember::name );
+
+					if( not known ) {
+						if constexpr( NeedsClassPositions ) {
+							auto const cf = parse_state.class_first;
+							auto const cl = parse_state.class_last;
+							parse_value_into<member_t, false>( parse_state, target );
+							parse_state.class_first = cf;
+							parse_state.class_last = cl;
+						} else {
+							parse_value_into<member_t, false>( parse_state, target );
+						}
+						return;
+					}
+					if( loc.is_null( ) ) {
+						daw_json_error(
+						  missing_member( std::string_view( std::data( JsonMember::name ),
+						                                    std::size( JsonMember::name ) ) ),
+						  parse_state );
+					}
+					// Member was previously skipped
+					parse_value_into<member_t, true>( loc, target );
+				}
+			}
+
+			///
+			/// @brief Parse a class the same way as parse_json_class, but into the
+			/// members of target.  The members are found with to_json_data
+			///
+			template<typename JsonClass, typename... JsonMembers, typename ParseState,
+			         typename T, std::size_t... Is>
+			DAW_ATTRIB_INLINE constexpr void
+			parse_json_class_into( ParseState &parse_state, T &target,
+			                       std::index_sequence<Is...> ) {
+				static_assert( is_a_json_type_v<JsonClass> );
+				static_assert( has_json_data_contract_trait_v<T>, "Unexpected type" );
+				using must_exist =
+				  daw::constant<( all_json_members_must_exist_v<T, ParseState>
+				                    ? AllMembersMustExist::yes
+				                    : AllMembersMustExist::no )>;
+				DAW_JSON_PARSER_STATS_SCOPE( T );
+
+				parse_state.trim_left( );
+				daw_json_assert_weak( parse_state.is_opening_brace_checked( ),
+				                      ErrorReason::InvalidClassStart, parse_state );
+
+				auto const old_class_pos = parse_state.get_class_position( );
+				parse_state.set_class_position( );
+				parse_state.remove_prefix( );
+				parse_state.trim_left( );
+
+				if constexpr( sizeof...( JsonMembers ) == 0 ) {
+					(void)target;
+				} else {
+					auto const members = json_data_contract<T>::to_json_data( target );
+					static_assert(
+					  std::tuple_size_v<daw::remove_cvref_t<decltype( members )>> ==
+					    sizeof...( JsonMembers ),
+					  "to_json_data must return a reference to each mapped member" );
+
+					using NeedClassPositions = std::bool_constant<(
+					  ( must_be_class_member_v<typename JsonMembers::without_name> or
+					    ... ) )>;
+
+					using location_members_t = class_location_members_t<JsonMembers...>;
+#if defined( DAW_JSON_BUGFIX_MSVC_KNOWN_LOC_ICE_003 )
+					auto known_locations = make_class_locations_info<ParseState>(
+					  static_cast<location_members_t const *>( nullptr ) );
+#else
+					auto known_locations =
+					  DAW_AS_CONSTANT( ( make_class_locations_info<ParseState>(
+					    static_cast<location_members_t const *>( nullptr ) ) ) );
+#endif
+					// The comma operator sequences the members left to right
+					( parse_class_member_into<
+					    Is, daw::traits::nth_type<Is, JsonMembers...>, must_exist::value,
+					    NeedClassPositions::value, location_members_t>(
+					    parse_state, known_locations,
+					    as_mutable( std::get<Is>( members ) ) ),
+					  ... );
+				}
+				class_cleanup_now<all_json_members_must_exist_v<T, ParseState>>(
+				  parse_state, old_class_pos );
+			}
+		} // namespace json_details
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
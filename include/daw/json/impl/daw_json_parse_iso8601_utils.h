@@ -241,9 +241,152 @@ namespace daw::json {
 				return result;
 			}
 
+			namespace datetime_details {
+				/***
+				 * Fixed layouts of 8 characters of a timestamp.  A '0' is any digit,
+				 * the other characters must match exactly.  The first character is in
+				 * the low byte, the same as daw::to_uint64_buffer
+				 */
+				constexpr UInt64 layout_bytes( char const ( &layout )[9] ) {
+					UInt64 result = UInt64( );
+					for( std::size_t n = 0; n < 8; ++n ) {
+						result |= to_uint64( static_cast<unsigned>(
+						            static_cast<unsigned char>( layout[n] ) ) )
+						          << ( 8U * n );
+					}
+					return result;
+				}
+
+				constexpr UInt64 layout_mask( char const ( &layout )[9],
+				                              bool is_digit ) {
+					UInt64 result = UInt64( );
+					for( std::size_t n = 0; n < 8; ++n ) {
+						if( ( layout[n] == '0' ) == is_digit ) {
+							result |= 0xFF_u64 << ( 8U * n );
+						}
+					}
+					return result;
+				}
+
+				struct timestamp_layout {
+					UInt64 bytes;
+					UInt64 digit_mask;
+					UInt64 separator_mask;
+
+					explicit constexpr timestamp_layout( char const ( &layout )[9] )
+					  : bytes( layout_bytes( layout ) )
+					  , digit_mask( layout_mask( layout, true ) )
+					  , separator_mask( layout_mask( layout, false ) ) {}
+
+					/// @brief Check chunk against the layout and set digits to the
+					/// value of each digit, the separators are zero
+					/// @return true when all the digits and separators match
+					constexpr bool match( UInt64 chunk, UInt64 &digits ) const {
+						// Digits become 0-9 and matching separators 0
+						auto const diff = chunk ^ bytes;
+						digits = diff & digit_mask;
+						// A byte is over 9 when adding 0x76 sets its high bit
+						return ( diff & separator_mask ) == UInt64( ) and
+						       ( ( ( digits + 0x7676'7676'7676'7676_u64 ) | digits ) &
+						         0x8080'8080'8080'8080_u64 ) == UInt64( );
+					}
+				};
+
+				inline constexpr auto canonical_date_layout =
+				  timestamp_layout( "0000-00-" );
+				inline constexpr auto canonical_time_layout =
+				  timestamp_layout( "00T00:00" );
+				inline constexpr auto canonical_millisecond_layout =
+				  timestamp_layout( ":00.000Z" );
+
+				/// @brief The two digit number starting at each byte of digits
+				constexpr UInt64 digit_pairs( UInt64 digits ) {
+					// Each pair is at most 99 and fits in its byte
+					return digits * 10U + ( digits >> 8U );
+				}
+
+				constexpr std::uint_least32_t byte_at( UInt64 value,
+				                                       std::size_t index ) {
+					return static_cast<std::uint_least32_t>(
+					  ( value >> ( 8U * index ) ) & 0xFF_u64 );
+				}
+
+				/***
+				 * Parse the canonical YYYY-MM-DDTHH:MM:SSZ and YYYY-MM-DDTHH:MM:SS.fffZ
+				 * layouts.  The separators are checked and the digits converted 8
+				 * characters at a time.
+				 * @return false when ts is not in a canonical layout and the general
+				 * parser must be used
+				 */
+				template<string_view_bounds_type Bounds>
+				constexpr bool
+				parse_canonical_timestamp( daw::basic_string_view<char, Bounds> ts,
+				                           date_parts &ymd, time_parts &hms ) {
+					if( std::size( ts ) != 20 and std::size( ts ) != 24 ) {
+						return false;
+					}
+					char const *const ptr = std::data( ts );
+					UInt64 date_digits = UInt64( );
+					UInt64 time_digits = UInt64( );
+					if( not( canonical_date_layout.match( daw::to_uint64_buffer( ptr ),
+					                                      date_digits ) and
+					         canonical_time_layout.match(
+					           daw::to_uint64_buffer( ptr + 8 ), time_digits ) ) ) {
+						return false;
+					}
+					if( std::size( ts ) == 24 ) {
+						UInt64 ms_digits = UInt64( );
+						if( not canonical_millisecond_layout.match(
+						      daw::to_uint64_buffer( ptr + 16 ), ms_digits ) ) {
+							return false;
+						}
+						auto const ms_pairs = digit_pairs( ms_digits );
+						hms.second = byte_at( ms_pairs, 1 );
+						hms.nanosecond =
+						  static_cast<std::uint64_t>( byte_at( ms_pairs, 4 ) * 10U +
+						                              byte_at( ms_digits, 6 ) ) *
+						  1'000'000U;
+					} else {
+						if( not( ptr[16] == ':' and parse_utils::is_number( ptr[17] ) and
+						         parse_utils::is_number( ptr[18] ) and ptr[19] == 'Z' ) ) {
+							return false;
+						}
+						hms.second = json_details::parse_digit( ptr[17] ) * 10U +
+						             json_details::parse_digit( ptr[18] );
+						hms.nanosecond = 0;
+					}
+					auto const date_pairs = digit_pairs( date_digits );
+					auto const time_pairs = digit_pairs( time_digits );
+					ymd.year = static_cast<std::int32_t>( byte_at( date_pairs, 0 ) * 100U +
+					                                      byte_at( date_pairs, 2 ) );
+					ymd.month = byte_at( date_pairs, 5 );
+					ymd.day = byte_at( time_pairs, 0 );
+					hms.hour = byte_at( time_pairs, 3 );
+					hms.minute = byte_at( time_pairs, 6 );
+
+					daw_json_ensure( ymd.month >= 1 and ymd.month <= 12,
+					                 ErrorReason::InvalidTimestamp );
+					daw_json_ensure( ymd.day >= 1 and ymd.day <= 31,
+					                 ErrorReason::InvalidTimestamp );
+					daw_json_ensure( hms.hour <= 24 and hms.minute <= 59 and
+					                   hms.second <= 60,
+					                 ErrorReason::InvalidTimestamp );
+					return true;
+				}
+			} // namespace datetime_details
+
 			template<typename TP, string_view_bounds_type Bounds>
 			constexpr TP
 			parse_iso8601_timestamp( daw::basic_string_view<char, Bounds> ts ) {
+				{
+					auto ymd = date_parts{ 0, 0, 0 };
+					auto hms = time_parts{ 0, 0, 0, 0 };
+					if( datetime_details::parse_canonical_timestamp( ts, ymd, hms ) ) {
+						return civil_to_time_point<TP>( ymd.year, ymd.month, ymd.day,
+						                                hms.hour, hms.minute, hms.second,
+						                                hms.nanosecond );
+					}
+				}
 				constexpr daw::string_view t_str = "T";
 				auto const date_str = ts.pop_front_until( t_str );
 				if( ts.empty( ) ) {
@@ -260,7 +403,8 @@ namespace daw::json {
 				  } );
 				// TODO: verify or parse timezone
 				time_parts hms = parse_iso_8601_time( time_str );
-				if( not( ts.empty( ) or ts.front( ) == 'Z' ) ) {
+				// RFC 3339 allows a lowercase z, only Z is in the canonical layouts
+				if( not( ts.empty( ) or ts.front( ) == 'Z' or ts.front( ) == 'z' ) ) {
 					daw_json_ensure( std::size( ts ) == 5 or std::size( ts ) == 6,
 					                 ErrorReason::InvalidTimestamp );
 					// The format will be (+|-)hh[:]mm
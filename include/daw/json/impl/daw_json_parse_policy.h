@@ -117,6 +117,13 @@ namespace daw::json {
 			  json_details::get_bits_for<options::ExcludeSpecialEscapes>(
 			    PolicyFlags ) == options::ExcludeSpecialEscapes::yes;
 
+			/***
+			 * See options::InPlaceUnescape
+			 */
+			static constexpr bool in_place_unescape =
+			  json_details::get_bits_for<options::InPlaceUnescape>( PolicyFlags ) ==
+			  options::InPlaceUnescape::yes;
+
 			/// @brief Allow numbers with leading zeros and pluses when parsing
 			static constexpr bool allow_leading_zero_plus = true;
 
@@ -544,6 +551,19 @@ namespace daw::json {
 		  daw::conditional_t<ParsePolicy::is_default_parse_policy,
 		                     DefaultParsePolicy, ParsePolicy>;
 
+		namespace json_details {
+			/***
+			 * The policy for text that is parsed more than once, e.g. a variant's tag
+			 * that is read ahead of its class or a json_value.  Strings must stay as
+			 * they are in the document for the next pass, so they are not unescaped
+			 * in place
+			 */
+			template<typename ParseState>
+			using reread_parse_state_t =
+			  TryDefaultParsePolicy<typename ParseState::template SetPolicyOptions<
+			    options::InPlaceUnescape::no>>;
+		} // namespace json_details
+
 		namespace options {
 			/***
 			 * @brief Specify parse policy flags in to_json calls.  See cookbook item
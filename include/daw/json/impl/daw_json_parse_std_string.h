@@ -13,6 +13,7 @@
 #include "daw/json/daw_json_switches.h"
 #include "daw_json_assert.h"
 #include "daw_json_parse_common.h"
+#include "daw_json_parser_diagnostics.h"
 #include "daw_not_const_ex_functions.h"
 
 #include <daw/algorithms/daw_algorithm_copy.h>
@@ -21,6 +22,8 @@
 #include <daw/daw_likely.h>
 
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <daw/stdinc/data_access.h>
 #include <daw/stdinc/range_access.h>
 #include <type_traits>
@@ -28,27 +31,55 @@
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
 		namespace json_details {
-			[[nodiscard]] static inline constexpr UInt8
-			to_nibble( unsigned char chr ) {
-				int const b = static_cast<int>( chr );
-				int const maskLetter = ( ( '9' - b ) >> 31 );
-				int const maskSmall = ( ( 'Z' - b ) >> 31 );
-				int const offset = '0' + ( maskLetter & int( 'A' - '0' - 10 ) ) +
-				                   ( maskSmall & int( 'a' - 'A' ) );
-				auto const result = static_cast<unsigned>( b - offset );
-				return to_uint8( result );
+			/***
+			 * Is every byte of the 4 packed characters a hex digit.  SWAR range
+			 * checks, each byte's high bit is set when it is in range
+			 */
+			[[nodiscard]] static inline constexpr bool
+			is_hex4( std::uint32_t packed ) {
+				constexpr std::uint32_t ones = 0x0101'0101U;
+				constexpr std::uint32_t low7 = ones * 0x7FU;
+				constexpr std::uint32_t high = ones * 0x80U;
+				// Bytes of x in ( lo, hi ) exclusive, lo and hi must be <= 128
+				constexpr auto between = []( std::uint32_t x, std::uint32_t lo,
+				                             std::uint32_t hi ) {
+					return ( ( ones * ( 127U + hi ) - ( x & low7 ) ) & ~x &
+					         ( ( x & low7 ) + ones * ( 127U - lo ) ) ) &
+					       high;
+				};
+				auto const digits = between( packed, '0' - 1U, '9' + 1U );
+				// Setting bit 5 folds 'A'-'F' onto 'a'-'f'
+				auto const letters =
+				  between( packed | ( ones * 0x20U ), 'a' - 1U, 'f' + 1U );
+				return ( digits | letters ) == high;
 			}
 
+			/***
+			 * Decode the 4 hex digits of a \uXXXX escape at once.  The characters
+			 * are packed into one word, the first in the low byte.  '0'-'9' have
+			 * bit 6 clear and letters have it set, so each digit's value is its low
+			 * nibble plus 9 when bit 6 is set
+			 */
 			template<bool is_unchecked_input>
 			DAW_ATTRIB_NONNULL( )
-			[[nodiscard]] static inline constexpr UInt16
-			  byte_from_nibbles( char const *&first ) {
-				auto const n0 = to_nibble( static_cast<unsigned char>( *first++ ) );
-				auto const n1 = to_nibble( static_cast<unsigned char>( *first++ ) );
+			[[nodiscard]] static inline constexpr UInt32
+			  hex4_to_u32( char const *&first ) {
+				auto const byte = [&]( std::size_t idx ) {
+					return static_cast<std::uint32_t>(
+					  static_cast<unsigned char>( first[idx] ) );
+				};
+				std::uint32_t const packed = byte( 0 ) | ( byte( 1 ) << 8U ) |
+				                             ( byte( 2 ) << 16U ) | ( byte( 3 ) << 24U );
 				if constexpr( is_unchecked_input ) {
-					daw_json_ensure( n0 < 16 and n1 < 16, ErrorReason::InvalidUTFEscape );
+					daw_json_ensure( is_hex4( packed ), ErrorReason::InvalidUTFEscape );
 				}
-				return to_uint16( ( n0 << 4U ) | n1 );
+				std::uint32_t const nibbles =
+				  ( packed & 0x0F0F'0F0FU ) + ( ( packed >> 6U ) & 0x0101'0101U ) * 9U;
+				first += 4;
+				return to_uint32( ( ( nibbles & 0xFFU ) << 12U ) |
+				                  ( ( ( nibbles >> 8U ) & 0xFFU ) << 8U ) |
+				                  ( ( ( nibbles >> 16U ) & 0xFFU ) << 4U ) |
+				                  ( nibbles >> 24U ) );
 			}
 
 			static constexpr char u32toC( UInt32 value ) {
@@ -64,9 +95,7 @@ namespace daw::json {
 				                      ErrorReason::UnexpectedEndOfData, parse_state );
 				char const *first = parse_state.first;
 				++first;
-				UInt32 cp = to_uint32( byte_from_nibbles<is_unchecked_input>( first ) )
-				            << 8U;
-				cp |= byte_from_nibbles<is_unchecked_input>( first );
+				UInt32 cp = hex4_to_u32<is_unchecked_input>( first );
 				if( cp <= 0x7FU ) {
 					*it++ = static_cast<char>( static_cast<unsigned char>( cp ) );
 					parse_state.first = first;
@@ -82,9 +111,7 @@ namespace daw::json {
 					  ErrorReason::InvalidUTFEscape,
 					  parse_state ); // Expected parse_state to start with a \\u
 					++first;
-					auto trailing =
-					  to_uint32( byte_from_nibbles<is_unchecked_input>( first ) ) << 8U;
-					trailing |= byte_from_nibbles<is_unchecked_input>( first );
+					auto trailing = hex4_to_u32<is_unchecked_input>( first );
 					trailing -= 0xDC00U;
 					cp += trailing;
 					cp += 0x10000;
@@ -135,9 +162,7 @@ namespace daw::json {
 				constexpr bool is_unchecked_input = ParseState::is_unchecked_input;
 				char const *first = parse_state.first;
 				++first;
-				UInt32 cp = to_uint32( byte_from_nibbles<is_unchecked_input>( first ) )
-				            << 8U;
-				cp |= byte_from_nibbles<is_unchecked_input>( first );
+				UInt32 cp = hex4_to_u32<is_unchecked_input>( first );
 				if( cp <= 0x7FU ) {
 					app( u32toC( cp ) );
 					parse_state.first = first;
@@ -149,9 +174,7 @@ namespace daw::json {
 					daw_json_assert_weak( *first == 'u', ErrorReason::InvalidUTFEscape,
 					                      parse_state );
 					++first;
-					auto trailing =
-					  to_uint32( byte_from_nibbles<is_unchecked_input>( first ) ) << 8U;
-					trailing |= byte_from_nibbles<is_unchecked_input>( first );
+					auto trailing = hex4_to_u32<is_unchecked_input>( first );
 					trailing -= 0xDC00U;
 					cp += trailing;
 					cp += 0x10000;
@@ -197,16 +220,71 @@ namespace daw::json {
 				inline constexpr char const escape_quotes[] = "\\\"";
 			}
 
-			// Fast path for parsing escaped strings to a std::string with the default
-			// appender
-			template<bool AllowHighEight, typename JsonMember, bool KnownBounds,
-			         typename ParseState>
-			[[nodiscard]] static constexpr auto
-			parse_string_known_stdstring( ParseState &parse_state ) {
-				using string_type = json_base_type_t<JsonMember>;
-				string_type result =
-				  string_type( std::size( parse_state ) + 1, '\0',
-				               parse_state.template get_allocator_for<char>( ) );
+			/***
+			 * The decoded character of each single character escape, indexed by
+			 * the character following the backslash.  0 for \\u and for characters
+			 * that are not escapes
+			 */
+			struct escape_table_t {
+				char values[256] = { };
+
+				constexpr char operator[]( char idx ) const {
+					return values[static_cast<unsigned char>( idx )];
+				}
+			};
+
+			inline constexpr escape_table_t escape_table = [] {
+				auto result = escape_table_t{ };
+				result.values[static_cast<unsigned char>( 'b' )] = '\b';
+				result.values[static_cast<unsigned char>( 'f' )] = '\f';
+				result.values[static_cast<unsigned char>( 'n' )] = '\n';
+				result.values[static_cast<unsigned char>( 'r' )] = '\r';
+				result.values[static_cast<unsigned char>( 't' )] = '\t';
+				result.values[static_cast<unsigned char>( '/' )] = '/';
+				result.values[static_cast<unsigned char>( '\\' )] = '\\';
+				result.values[static_cast<unsigned char>( '"' )] = '"';
+				return result;
+			}( );
+
+			/***
+			 * Decode the escape sequence at the front of parse_state, the backslash
+			 * has already been removed, and write the result to it.  The output is
+			 * never longer than the input
+			 * @return The position after the decoded characters
+			 */
+			template<bool AllowHighEight, typename ParseState>
+			DAW_ATTRIB_NONNULL( )
+			DAW_ATTRIB_RET_NONNULL DAW_ATTRIB_INLINE static constexpr char *
+			  decode_escape( ParseState &parse_state, char *it ) {
+				char const c = parse_state.front( );
+				if( char const decoded = escape_table[c]; DAW_LIKELY( decoded != 0 ) ) {
+					*it++ = decoded;
+					parse_state.remove_prefix( );
+					return it;
+				}
+				if( c == 'u' ) {
+					return decode_utf16( parse_state, it );
+				}
+				if constexpr( not AllowHighEight ) {
+					daw_json_assert_weak(
+					  ( not parse_state.is_space_unchecked( ) ) &
+					    ( static_cast<unsigned char>( c ) <= 0x7FU ),
+					  ErrorReason::InvalidStringHighASCII, parse_state );
+				}
+				*it++ = c;
+				parse_state.remove_prefix( );
+				return it;
+			}
+
+			// Unescape the string into result, reusing its capacity.  result is
+			// resized to fit the unescaped string
+			template<bool AllowHighEight, bool KnownBounds, typename ParseState,
+			         typename String>
+			static constexpr void
+			parse_string_known_stdstring_into( ParseState &parse_state,
+			                                   String &result ) {
+				DAW_JSON_COUNT_PARSER_EVENT( slow_path_string );
+				result.resize( std::size( parse_state ) + 1 );
 				char *it = std::data( result );
 
 				bool const has_quote = parse_state.front( ) == '"';
@@ -248,6 +326,15 @@ namespace daw::json {
 								                      parse_state );
 							}
 						} else {
+#if defined( DAW_ALLOW_SSE42 )
+							if constexpr( std::is_same_v<typename ParseState::exec_tag_t,
+							                             sse42_exec_tag> ) {
+								// Copy whole blocks while searching for the end of the run
+								first = mem_copy_to_next_of<'"', '\\'>( ParseState::exec_tag,
+								                                        first, last, it );
+								parse_state.first = first;
+							}
+#endif
 							first =
 							  mem_move_to_next_of<( ParseState::is_unchecked_input or
 							                        ParseState::is_zero_terminated_string ),
@@ -267,47 +354,7 @@ namespace daw::json {
 						daw_json_assert_weak( not parse_state.is_space_unchecked( ),
 						                      ErrorReason::InvalidUTFCodepoint,
 						                      parse_state );
-						switch( parse_state.front( ) ) {
-						case 'b':
-							*it++ = '\b';
-							parse_state.remove_prefix( );
-							break;
-						case 'f':
-							*it++ = '\f';
-							parse_state.remove_prefix( );
-							break;
-						case 'n':
-							*it++ = '\n';
-							parse_state.remove_prefix( );
-							break;
-						case 'r':
-							*it++ = '\r';
-							parse_state.remove_prefix( );
-							break;
-						case 't':
-							*it++ = '\t';
-							parse_state.remove_prefix( );
-							break;
-						case 'u':
-							it = decode_utf16( parse_state, it );
-							break;
-						case '/':
-						case '\\':
-						case '"':
-							*it++ = parse_state.front( );
-							parse_state.remove_prefix( );
-							break;
-						default:
-							if constexpr( not AllowHighEight ) {
-								daw_json_assert_weak(
-								  ( not parse_state.is_space_unchecked( ) ) &
-								    ( static_cast<unsigned char>( parse_state.front( ) ) <=
-								      0x7FU ),
-								  ErrorReason::InvalidStringHighASCII, parse_state );
-							}
-							*it++ = parse_state.front( );
-							parse_state.remove_prefix( );
-						}
+						it = decode_escape<AllowHighEight>( parse_state, it );
 					} else {
 						daw_json_assert_weak( not has_quote or
 						                        parse_state.is_quotes_checked( ),
@@ -321,6 +368,20 @@ namespace daw::json {
 				daw_json_assert_weak( std::size( result ) >= sz,
 				                      ErrorReason::InvalidString, parse_state );
 				result.resize( sz );
+			}
+
+			// Fast path for parsing escaped strings to a std::string with the default
+			// appender
+			template<bool AllowHighEight, typename JsonMember, bool KnownBounds,
+			         typename ParseState>
+			[[nodiscard]] static constexpr auto
+			parse_string_known_stdstring( ParseState &parse_state ) {
+				using string_type = json_base_type_t<JsonMember>;
+				string_type result =
+				  string_type( std::size( parse_state ) + 1, '\0',
+				               parse_state.template get_allocator_for<char>( ) );
+				parse_string_known_stdstring_into<AllowHighEight, KnownBounds>(
+				  parse_state, result );
 				if constexpr( std::is_convertible_v<string_type,
 				                                    json_result_t<JsonMember>> ) {
 					return result;
@@ -330,6 +391,73 @@ namespace daw::json {
 					  parse_state, std::data( result ), daw::data_end( result ) );
 				}
 			}
+
+			/***
+			 * Unescape a string inside its own quotes.  The decoded form is never
+			 * longer than the escaped form, so the output never overtakes the input.
+			 * Only used when options::InPlaceUnescape is set, the caller has promised
+			 * that the buffer is mutable.
+			 * @param parse_state The string contents without quotes, counter must
+			 * hold the position of the first escape + 1 as skip_string sets it
+			 * @return The end of the unescaped string, it starts at the original
+			 * parse_state.first
+			 */
+			template<bool AllowHighEight, typename ParseState>
+			[[nodiscard]] DAW_ATTRIB_RET_NONNULL static inline char *
+			parse_string_in_place( ParseState &parse_state ) {
+				static_assert( ParseState::in_place_unescape,
+				               "options::InPlaceUnescape must be enabled to modify the "
+				               "buffer being parsed" );
+				DAW_JSON_COUNT_PARSER_EVENT( slow_path_string );
+				// The buffer is only const to the parser, the caller owns a mutable one
+				char *it = const_cast<char *>( parse_state.first );
+				if( auto const first_slash =
+				      static_cast<std::ptrdiff_t>( parse_state.counter ) - 1;
+				    first_slash > 0 ) {
+					// Everything prior to the first escape is already in place
+					it += first_slash;
+					parse_state.first += first_slash;
+				}
+				while( parse_state.has_more( ) ) {
+					char const *first = parse_state.first;
+					char const *const last = parse_state.last;
+					if constexpr( std::is_same_v<typename ParseState::exec_tag_t,
+					                             constexpr_exec_tag> ) {
+						while( first < last and *first != '\\' ) {
+							++first;
+						}
+					} else {
+#if defined( DAW_ALLOW_SSE42 )
+						if constexpr( std::is_same_v<typename ParseState::exec_tag_t,
+						                             sse42_exec_tag> ) {
+							// it never passes first and only the part of a block before the
+							// escape is copied, the escape itself is not overwritten
+							first = mem_copy_to_next_of<'\\'>( ParseState::exec_tag, first,
+							                                   last, it );
+							parse_state.first = first;
+						}
+#endif
+						first = mem_move_to_next_of<false, '\\'>( ParseState::exec_tag,
+						                                          first, last );
+					}
+					auto const sz =
+					  static_cast<std::size_t>( std::distance( parse_state.first, first ) );
+					if( it != parse_state.first ) {
+						std::memmove( it, parse_state.first, sz );
+					}
+					it += sz;
+					parse_state.first = first;
+					if( not parse_state.has_more( ) ) {
+						break;
+					}
+					parse_state.remove_prefix( );
+					daw_json_assert_weak( parse_state.has_more( ) and
+					                        not parse_state.is_space_unchecked( ),
+					                      ErrorReason::InvalidUTFCodepoint, parse_state );
+					it = decode_escape<AllowHighEight>( parse_state, it );
+				}
+				return it;
+			}
 		} // namespace json_details
 	} // namespace DAW_JSON_VER
 } // namespace daw::json
@@ -11,6 +11,7 @@
 #include "version.h"
 
 #include "daw_json_assert.h"
+#include "daw_json_lazy_value.h"
 #include "daw_json_parse_array_iterator.h"
 #include "daw_json_parse_kv_array_iterator.h"
 #include "daw_json_parse_kv_class_iterator.h"
@@ -21,6 +22,7 @@
 #include "daw_json_parse_string_quote.h"
 #include "daw_json_parse_unsigned_int.h"
 #include "daw_json_parse_value_fwd.h"
+#include "daw_json_preserved_value.h"
 #include "daw_json_traits.h"
 #include "daw_json_value_fwd.h"
 
@@ -36,7 +38,9 @@
 #include <cstddef>
 #include <cstdint>
 #include <daw/stdinc/data_access.h>
+#include <daw/stdinc/integer_sequence.h>
 #include <daw/stdinc/tuple_traits.h>
+#include <string>
 #include <type_traits>
 
 namespace daw::json {
@@ -474,6 +478,20 @@ namespace daw::json {
 			DAW_JSON_MAKE_REQ_TYPE_ALIAS_TRAIT_NT( has_json_member_parse_to_v,
 			                                       json_result_t<T> );
 
+			DAW_JSON_MAKE_REQ_TYPE_ALIAS_TRAIT( is_interned_string_v,
+			                                    T::i_am_an_interned_string );
+
+			/***
+			 * A scratch string to unescape into before interning.  Only the
+			 * unescaped characters are kept in the pool
+			 */
+			template<typename Allocator>
+			struct interned_string_buffer {
+				using parse_to_t =
+				  std::basic_string<char, std::char_traits<char>, Allocator>;
+				using constructor_t = default_constructor<parse_to_t>;
+			};
+
 			template<typename JsonMember, bool KnownBounds, typename ParseState>
 			[[nodiscard]] DAW_ATTRIB_INLINE static constexpr json_result_t<JsonMember>
 			parse_value_string_escaped( ParseState &parse_state ) {
@@ -484,7 +502,47 @@ namespace daw::json {
 					                 ErrorReason::UnexpectedNull );
 				}
 				using constructor_t = json_constructor_t<JsonMember>;
-				if constexpr( can_parse_to_stdstring_fast_v<JsonMember> ) {
+				if constexpr( ParseState::in_place_unescape ) {
+					// The buffer is ours to modify, unescape within the string's own
+					// quotes and construct from that.  string_view results can refer to
+					// the document and no allocation is needed
+					using AllowHighEightbits =
+					  std::bool_constant<JsonMember::eight_bit_mode !=
+					                     options::EightBitModes::DisallowHigh>;
+					auto parse_state2 =
+					  KnownBounds ? parse_state : skip_string( parse_state );
+					char const *const first = std::data( parse_state2 );
+					char const *last = daw::data_end( parse_state2 );
+					if( not AllowHighEightbits::value or
+					    needs_slow_path( parse_state2 ) ) {
+						last =
+						  parse_string_in_place<AllowHighEightbits::value>( parse_state2 );
+					}
+					return construct_value<json_result_t<JsonMember>, constructor_t>(
+					  parse_state, first, last );
+				} else if constexpr( is_interned_string_v<json_result_t<JsonMember>> ) {
+					using AllowHighEightbits =
+					  std::bool_constant<JsonMember::eight_bit_mode !=
+					                     options::EightBitModes::DisallowHigh>;
+					auto parse_state2 =
+					  KnownBounds ? parse_state : skip_string( parse_state );
+					if( not AllowHighEightbits::value or
+					    needs_slow_path( parse_state2 ) ) {
+						// There are escapes in the string, the pool only sees the
+						// unescaped value
+						using buffer_t = interned_string_buffer<decltype(
+						  parse_state.template get_allocator_for<char>( ) )>;
+						auto const buff =
+						  parse_string_known_stdstring<AllowHighEightbits::value, buffer_t,
+						                               true>( parse_state2 );
+						return construct_value<json_result_t<JsonMember>, constructor_t>(
+						  parse_state, std::data( buff ), daw::data_end( buff ) );
+					}
+					// Intern straight from the document
+					return construct_value<json_result_t<JsonMember>, constructor_t>(
+					  parse_state, std::data( parse_state2 ),
+					  daw::data_end( parse_state2 ) );
+				} else if constexpr( can_parse_to_stdstring_fast_v<JsonMember> ) {
 					using AllowHighEightbits =
 					  std::bool_constant<JsonMember::eight_bit_mode !=
 					                     options::EightBitModes::DisallowHigh>;
@@ -610,6 +668,16 @@ namespace daw::json {
 				}
 			}
 
+			/// @brief The number of members of the class starting at parse_state,
+			/// it is 1 for an empty class.  parse_state is not moved
+			template<typename ParseState>
+			[[nodiscard]] DAW_ATTRIB_INLINE static constexpr std::size_t
+			count_members( ParseState parse_state ) {
+				// The counter of a skipped class is the number of commas between its
+				// members
+				return parse_state.skip_class( ).counter + 1U;
+			}
+
 			/**
 			 * Parse a key_value pair encoded as a json object where the keys are
 			 * the member names
@@ -628,16 +696,27 @@ namespace daw::json {
 				                      ErrorReason::ExpectedKeyValueToStartWithBrace,
 				                      parse_state );
 
-				parse_state.remove_prefix( );
-				parse_state.trim_left( );
-
 				using iter_t =
 				  json_parse_kv_class_iterator<JsonMember, ParseState,
 				                               can_be_random_iterator_v<KnownBounds>>;
 
 				using constructor_t = json_constructor_t<JsonMember>;
-				return construct_value<json_result_t<JsonMember>, constructor_t>(
-				  parse_state, iter_t( parse_state ), iter_t( ) );
+				if constexpr( not ParseState::has_allocator and
+				              std::is_invocable_v<constructor_t, iter_t, iter_t,
+				                                  container_size_hint> ) {
+					// The constructor can size the container up front, count the
+					// members first so that it is not grown one member at a time
+					auto const hint = container_size_hint{ count_members( parse_state ) };
+					parse_state.remove_prefix( );
+					parse_state.trim_left( );
+					return construct_value<json_result_t<JsonMember>, constructor_t>(
+					  parse_state, iter_t( parse_state ), iter_t( ), hint );
+				} else {
+					parse_state.remove_prefix( );
+					parse_state.trim_left( );
+					return construct_value<json_result_t<JsonMember>, constructor_t>(
+					  parse_state, iter_t( parse_state ), iter_t( ) );
+				}
 			}
 
 			/**
@@ -794,42 +873,59 @@ namespace daw::json {
 				}
 			}
 
-			template<typename Result, typename TypeList, std::size_t pos = 0,
+			template<typename Result, typename TypeList, std::size_t pos,
 			         typename ParseState>
-			DAW_ATTRIB_INLINE static constexpr Result
-			parse_visit( std::size_t idx, ParseState &parse_state ) {
-				if( idx == pos ) {
-					using JsonMember = pack_element_t<pos, TypeList>;
-					if constexpr( std::is_same_v<json_result_t<JsonMember>, Result> ) {
-						return parse_value<JsonMember, false, JsonMember::expected_type>(
-						  parse_state );
-					} else {
-						return Result{
-						  parse_value<JsonMember, false, JsonMember::expected_type>(
-						    parse_state ) };
-					}
-				}
-				if constexpr( pos + 1 < pack_size_v<TypeList> ) {
-					return parse_visit<Result, TypeList, pos + 1>( idx, parse_state );
+			static constexpr Result parse_visit_alternative( ParseState &parse_state ) {
+				using JsonMember = pack_element_t<pos, TypeList>;
+				if constexpr( std::is_same_v<json_result_t<JsonMember>, Result> ) {
+					return parse_value<JsonMember, false, JsonMember::expected_type>(
+					  parse_state );
 				} else {
-					if constexpr( ParseState::is_unchecked_input ) {
-						DAW_UNREACHABLE( );
-					} else {
-						daw_json_error( ErrorReason::MissingMemberNameOrEndOfClass,
-						                parse_state );
-					}
+					return Result{
+					  parse_value<JsonMember, false, JsonMember::expected_type>(
+					    parse_state ) };
 				}
 			}
 
+			template<typename Result, typename TypeList, typename ParseState,
+			         std::size_t... Is>
+			DAW_ATTRIB_INLINE static constexpr Result
+			parse_visit( std::size_t idx, ParseState &parse_state,
+			             std::index_sequence<Is...> ) {
+				using parse_alternative_t = Result ( * )( ParseState & );
+				// Indexed by the switcher result so that large variants do not compare
+				// against every prior alternative
+				constexpr parse_alternative_t alternatives[] = {
+				  parse_visit_alternative<Result, TypeList, Is, ParseState>... };
+
+				daw_json_assert_weak( idx < sizeof...( Is ),
+				                      ErrorReason::MissingMemberNameOrEndOfClass,
+				                      parse_state );
+				DAW_ASSUME( idx < sizeof...( Is ) );
+				return alternatives[idx]( parse_state );
+			}
+
+			template<typename Result, typename TypeList, typename ParseState>
+			DAW_ATTRIB_INLINE static constexpr Result
+			parse_visit( std::size_t idx, ParseState &parse_state ) {
+				return parse_visit<Result, TypeList>(
+				  idx, parse_state, std::make_index_sequence<pack_size_v<TypeList>>{ } );
+			}
+
+			/***
+			 * The tag is read ahead of the class that holds it and the class is
+			 * parsed again afterwards, see reread_parse_state_t
+			 */
 			template<typename JsonMember, typename ParseState>
 			static constexpr auto find_index( ParseState const &parse_state ) {
 				using tag_member = typename JsonMember::tag_member;
 				using class_wrapper_t = typename JsonMember::tag_member_class_wrapper;
 
 				using switcher_t = typename JsonMember::switcher;
-				auto parse_state2 =
-				  ParseState( parse_state.class_first, parse_state.class_last,
-				              parse_state.class_first, parse_state.class_last );
+				auto parse_state2 = reread_parse_state_t<ParseState>(
+				  parse_state.class_first, parse_state.class_last,
+				  parse_state.class_first, parse_state.class_last,
+				  parse_state.get_allocator( ) );
 				if constexpr( is_an_ordered_member_v<tag_member> ) {
 					// This is an ordered class, class must start with '['
 					daw_json_assert_weak( parse_state2.is_opening_bracket_checked( ),
@@ -864,7 +960,10 @@ namespace daw::json {
 					using tag_submember = typename JsonMember::tag_submember;
 					using class_wrapper_t =
 					  typename JsonMember::tag_submember_class_wrapper;
-					auto parse_state2 = parse_state;
+					auto parse_state2 = reread_parse_state_t<ParseState>(
+					  parse_state.first, parse_state.last, parse_state.class_first,
+					  parse_state.class_last, parse_state.get_allocator( ) );
+					parse_state2.counter = parse_state.counter;
 					using switcher_t = typename JsonMember::switcher;
 					if constexpr( is_an_ordered_member_v<tag_submember> ) {
 						return switcher_t{ }( std::get<0>(
@@ -1158,11 +1257,120 @@ namespace daw::json {
 				  std::make_index_sequence<std::tuple_size_v<element_pack>>{ } );
 			}
 
+			/***
+			 * The JSON text of a value that was skipped earlier.  The ranges of
+			 * strings do not have their quotes
+			 */
+			template<typename ParseState>
+			[[nodiscard]] constexpr std::string_view
+			known_value_source( ParseState const &parse_state ) {
+				char const *first = std::data( parse_state );
+				char const *last = daw::data_end( parse_state );
+				if( first[-1] == '"' ) {
+					--first;
+					++last;
+				}
+				return std::string_view( first,
+				                         static_cast<std::size_t>( last - first ) );
+			}
+
+			/***
+			 * Parse the value of a json_preserved member as its value_type with the
+			 * policy of the document and remember the text it was parsed from.
+			 */
+			template<typename JsonMember, bool KnownBounds, typename ParseState>
+			static constexpr json_result_t<JsonMember>
+			parse_value_preserved( ParseState &parse_state ) {
+				using result_t = json_result_t<JsonMember>;
+				using value_member_t =
+				  json_deduced_type<typename result_t::value_type>;
+				static_assert( not ParseState::in_place_unescape,
+				               "json_preserved cannot keep the source text when "
+				               "strings are unescaped in place" );
+				if constexpr( KnownBounds ) {
+					auto const source = known_value_source( parse_state );
+					auto value =
+					  parse_value<value_member_t, true, value_member_t::expected_type>(
+					    parse_state );
+					return result_t( std::move( value ), source );
+				} else if constexpr( std::is_same_v<typename ParseState::CommentPolicy,
+				                                    NoCommentSkippingPolicy> ) {
+					// Parse straight from the document and take the range that was
+					// consumed, less the trailing whitespace
+					char const *const first = std::data( parse_state );
+					auto value =
+					  parse_value<value_member_t, false, value_member_t::expected_type>(
+					    parse_state );
+					char const *last = std::data( parse_state );
+					while( last != first and
+					       static_cast<unsigned char>( last[-1] ) <= 0x20U ) {
+						--last;
+					}
+					return result_t( std::move( value ),
+					                 std::string_view( first, static_cast<std::size_t>(
+					                                            last - first ) ) );
+				} else {
+					// Trailing comments are consumed with the value, so it has to be
+					// bounded first to keep them out of the source text
+					auto value_parse_state = skip_value<true>( parse_state );
+					auto const source = std::string_view(
+					  std::data( value_parse_state ), std::size( value_parse_state ) );
+					auto value =
+					  parse_value<value_member_t, false, value_member_t::expected_type>(
+					    value_parse_state );
+					return result_t( std::move( value ), source );
+				}
+			}
+
+			/***
+			 * Parse the source text of a json_lazy_value with the options of the
+			 * document it came from.  The text is part of that document, so it is
+			 * not zero terminated, and it is not unescaped in place as it may still
+			 * be written back.  The Allocator may not outlive the parse and is not
+			 * used
+			 */
+			template<typename T, typename ParseState>
+			[[nodiscard]] constexpr T parse_lazy_value( std::string_view source ) {
+				using lazy_policy_t = typename ParseState::without_allocator_type::
+				  template SetPolicyOptions<options::ZeroTerminatedString::no,
+				                            options::InPlaceUnescape::no>;
+				using value_member_t = json_deduced_type<T>;
+				auto parse_state =
+				  lazy_policy_t( std::data( source ), daw::data_end( source ) );
+				return parse_value<value_member_t, false,
+				                   value_member_t::expected_type>( parse_state );
+			}
+
+			/***
+			 * Keep the source range of a json_lazy member, it is parsed with the
+			 * options of this document on first access
+			 */
+			template<typename JsonMember, bool KnownBounds, typename ParseState>
+			[[nodiscard]] static constexpr json_result_t<JsonMember>
+			parse_value_lazy( ParseState &parse_state ) {
+				using result_t = json_result_t<JsonMember>;
+				using value_t = typename result_t::value_type;
+				constexpr auto parse = &parse_lazy_value<value_t, ParseState>;
+				if constexpr( KnownBounds ) {
+					return result_t( known_value_source( parse_state ), parse );
+				} else {
+					auto const value_parse_state =
+					  skip_known_value<json_deduced_type<value_t>, true>( parse_state );
+					return result_t( std::string_view( std::data( value_parse_state ),
+					                                   std::size( value_parse_state ) ),
+					                 parse );
+				}
+			}
+
 			template<typename JsonMember, bool KnownBounds, typename ParseState>
 			DAW_ATTRIB_INLINE static constexpr json_result_t<JsonMember>
 			parse_value_unknown( ParseState &parse_state ) {
 				using constructor_t = json_constructor_t<JsonMember>;
-				if constexpr( KnownBounds ) {
+				if constexpr( is_json_preserved_value_v<json_result_t<JsonMember>> ) {
+					return parse_value_preserved<JsonMember, KnownBounds>( parse_state );
+				} else if constexpr( is_json_lazy_value_v<json_result_t<JsonMember>> ) {
+					return parse_value_lazy<JsonMember, KnownBounds>( parse_state );
+				} else if constexpr( KnownBounds ) {
 					return construct_value<json_result_t<JsonMember>, constructor_t>(
 					  parse_state, std::data( parse_state ), std::size( parse_state ) );
 				} else {
@@ -0,0 +1,225 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include <daw/daw_attributes.h>
+#include <daw/daw_is_constant_evaluated.h>
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#if defined( DAW_JSON_PARSER_DIAGNOSTICS )
+#include <memory>
+#include <utility>
+#endif
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/***
+		 * How often the parser took its slower paths while parsing one mapped
+		 * type.  Collected on each thread when DAW_JSON_PARSER_DIAGNOSTICS is
+		 * defined, see get_parser_stats( )
+		 */
+		struct json_parser_stats {
+			/// @brief The name of the mapped type, events outside of any mapped
+			/// class are counted in "(top level)"
+			std::string_view type_name;
+			/// @brief The number of times the type was parsed
+			std::size_t classes_parsed = 0;
+			/// @brief Members that came before a member mapped ahead of them and had
+			/// to be skipped and revisited
+			std::size_t out_of_order_members = 0;
+			/// @brief Members in the JSON that are not mapped and were skipped
+			std::size_t unknown_members = 0;
+			/// @brief Strings with escapes, or high bit characters when those are
+			/// disallowed, that needed to be unescaped
+			std::size_t slow_path_strings = 0;
+			/// @brief Real numbers that fell back to parse_with_strtod
+			std::size_t strtod_fallbacks = 0;
+			/// @brief std::vector's of unknown size that outgrew their initial
+			/// reservation
+			std::size_t array_regrowths = 0;
+		};
+
+		namespace json_details {
+			enum class parser_event {
+				out_of_order_member,
+				unknown_member,
+				slow_path_string,
+				strtod_fallback,
+				array_regrowth
+			};
+
+#if defined( DAW_JSON_PARSER_DIAGNOSTICS )
+			/// @brief The name of T as the compiler spells it
+			template<typename T>
+			[[nodiscard]] std::string_view parser_stats_type_name( ) {
+#if defined( _MSC_VER ) and not defined( __clang__ )
+				auto const name = std::string_view( __FUNCSIG__ );
+				auto const prefix = std::string_view( "parser_stats_type_name<" );
+				auto const first = name.find( prefix ) + prefix.size( );
+				auto const last = name.rfind( ">(void)" );
+#else
+				auto const name = std::string_view( __PRETTY_FUNCTION__ );
+				auto const prefix = std::string_view( "T = " );
+				auto const first = name.find( prefix ) + prefix.size( );
+				auto last = name.find( ';', first );
+				if( last == std::string_view::npos ) {
+					last = name.rfind( ']' );
+				}
+#endif
+				return name.substr( first, last - first );
+			}
+
+			/// @brief The stats of every type parsed on this thread
+			[[nodiscard]] inline std::vector<std::unique_ptr<json_parser_stats>> &
+			parser_stats_registry( ) {
+				static thread_local auto registry =
+				  std::vector<std::unique_ptr<json_parser_stats>>( );
+				return registry;
+			}
+
+			[[nodiscard]] inline json_parser_stats &
+			register_parser_stats( std::string_view type_name ) {
+				auto &registry = parser_stats_registry( );
+				registry.push_back( std::make_unique<json_parser_stats>( ) );
+				registry.back( )->type_name = type_name;
+				return *registry.back( );
+			}
+
+			template<typename T>
+			[[nodiscard]] json_parser_stats &parser_stats_for( ) {
+				static thread_local json_parser_stats &stats =
+				  register_parser_stats( parser_stats_type_name<T>( ) );
+				return stats;
+			}
+
+			/// @brief The stats of the innermost class being parsed on this thread
+			[[nodiscard]] inline json_parser_stats *&current_parser_stats( ) {
+				static thread_local json_parser_stats *current = nullptr;
+				return current;
+			}
+
+			DAW_ATTRIB_NOINLINE inline void
+			count_parser_event_runtime( parser_event event ) {
+				auto *stats = current_parser_stats( );
+				if( stats == nullptr ) {
+					static thread_local json_parser_stats &top_level =
+					  register_parser_stats( "(top level)" );
+					stats = &top_level;
+				}
+				switch( event ) {
+				case parser_event::out_of_order_member:
+					++stats->out_of_order_members;
+					break;
+				case parser_event::unknown_member:
+					++stats->unknown_members;
+					break;
+				case parser_event::slow_path_string:
+					++stats->slow_path_strings;
+					break;
+				case parser_event::strtod_fallback:
+					++stats->strtod_fallbacks;
+					break;
+				case parser_event::array_regrowth:
+					++stats->array_regrowths;
+					break;
+				}
+			}
+
+			template<parser_event Event>
+			DAW_ATTRIB_INLINE constexpr void count_parser_event( ) {
+#if defined( DAW_IS_CONSTANT_EVALUATED )
+				if( DAW_IS_CONSTANT_EVALUATED( ) ) {
+					return;
+				}
+#endif
+				count_parser_event_runtime( Event );
+			}
+
+			/// @brief Attribute the events while it is alive to T
+			class parser_stats_scope {
+				json_parser_stats *m_previous = nullptr;
+				bool m_is_active = false;
+
+				void enter( json_parser_stats &stats ) {
+					m_previous = std::exchange( current_parser_stats( ), &stats );
+					m_is_active = true;
+					++stats.classes_parsed;
+				}
+
+				void leave( ) {
+					current_parser_stats( ) = m_previous;
+				}
+
+			public:
+				template<typename T>
+				explicit constexpr parser_stats_scope( T const * ) {
+#if defined( DAW_IS_CONSTANT_EVALUATED )
+					if( DAW_IS_CONSTANT_EVALUATED( ) ) {
+						return;
+					}
+#endif
+					enter( parser_stats_for<T>( ) );
+				}
+
+				parser_stats_scope( parser_stats_scope const & ) = delete;
+				parser_stats_scope &operator=( parser_stats_scope const & ) = delete;
+
+				DAW_JSON_CPP20_CX_DTOR ~parser_stats_scope( ) {
+					if( m_is_active ) {
+						leave( );
+					}
+				}
+			};
+#endif
+		} // namespace json_details
+
+		/// @brief A copy of the parser statistics of this thread, one entry per
+		/// type parsed.  Empty unless DAW_JSON_PARSER_DIAGNOSTICS is defined
+		[[nodiscard]] inline std::vector<json_parser_stats> get_parser_stats( ) {
+			auto result = std::vector<json_parser_stats>( );
+#if defined( DAW_JSON_PARSER_DIAGNOSTICS )
+			auto const &registry = json_details::parser_stats_registry( );
+			result.reserve( registry.size( ) );
+			for( auto const &stats : registry ) {
+				result.push_back( *stats );
+			}
+#endif
+			return result;
+		}
+
+		/// @brief Zero the parser statistics of this thread
+		inline void reset_parser_stats( ) {
+#if defined( DAW_JSON_PARSER_DIAGNOSTICS )
+			for( auto &stats : json_details::parser_stats_registry( ) ) {
+				*stats = json_parser_stats{ stats->type_name };
+			}
+#endif
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
+
+#if defined( DAW_JSON_PARSER_DIAGNOSTICS )
+/// Count a parser_event against the class currently being parsed
+#define DAW_JSON_COUNT_PARSER_EVENT( Event )     \
+	::daw::json::json_details::count_parser_event< \
+	  ::daw::json::json_details::parser_event::Event>( )
+
+/// Attribute the parser events until the end of the scope to the type
+#define DAW_JSON_PARSER_STATS_SCOPE( ... )                             \
+	::daw::json::json_details::parser_stats_scope const                  \
+	  daw_json_parser_stats_scope( static_cast<__VA_ARGS__ const *>( nullptr ) )
+#else
+#define DAW_JSON_COUNT_PARSER_EVENT( Event ) (void)0
+#define DAW_JSON_PARSER_STATS_SCOPE( ... ) (void)0
+#endif
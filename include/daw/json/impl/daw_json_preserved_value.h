@@ -0,0 +1,123 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include <daw/stdinc/move_fwd_exch.h>
+
+#include <string_view>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/***
+		 * A parsed value that remembers the JSON text it was parsed from.  While
+		 * it is unmodified, serialization writes the original text back with a
+		 * single buffer copy instead of re-encoding the value.  Mutating it via
+		 * mutable_value( ), assignment, or mark_dirty( ) forgets the source text
+		 * and serialization falls back to the mapping of T.
+		 * The source text is not owned, the JSON document must outlive the value
+		 * while it is not dirty.
+		 * @tparam T The parsed type, must be mapped or deducible
+		 */
+		template<typename T>
+		class json_preserved_value {
+			T m_value{ };
+			std::string_view m_source{ };
+			bool m_is_dirty = true;
+
+		public:
+			using value_type = T;
+
+			json_preserved_value( ) = default;
+
+			/// @brief Construct from a value without any source text. It will
+			/// always be serialized from value
+			explicit constexpr json_preserved_value( T const &value )
+			  : m_value( value ) {}
+
+			/// @brief Construct from a value without any source text. It will
+			/// always be serialized from value
+			explicit constexpr json_preserved_value( T &&value )
+			  : m_value( std::move( value ) ) {}
+
+			/// @brief Construct from a value and the JSON text it was parsed from
+			constexpr json_preserved_value( T value, std::string_view source )
+			  : m_value( std::move( value ) )
+			  , m_source( source )
+			  , m_is_dirty( false ) {}
+
+			constexpr json_preserved_value &operator=( T const &value ) {
+				m_value = value;
+				mark_dirty( );
+				return *this;
+			}
+
+			constexpr json_preserved_value &operator=( T &&value ) {
+				m_value = std::move( value );
+				mark_dirty( );
+				return *this;
+			}
+
+			[[nodiscard]] constexpr T const &value( ) const {
+				return m_value;
+			}
+
+			[[nodiscard]] constexpr T const &operator*( ) const {
+				return m_value;
+			}
+
+			[[nodiscard]] constexpr T const *operator->( ) const {
+				return &m_value;
+			}
+
+			/// @brief Access the value for modification.  This marks the value
+			/// dirty, even if it is not changed
+			[[nodiscard]] constexpr T &mutable_value( ) {
+				mark_dirty( );
+				return m_value;
+			}
+
+			/// @brief The source text is no longer used for serialization
+			constexpr void mark_dirty( ) {
+				m_is_dirty = true;
+				m_source = std::string_view{ };
+			}
+
+			/// @brief Is value serialized from T's mapping instead of the source
+			/// text
+			[[nodiscard]] constexpr bool is_dirty( ) const {
+				return m_is_dirty;
+			}
+
+			/// @brief The original JSON text of the value. Empty when dirty
+			[[nodiscard]] constexpr std::string_view source( ) const {
+				return m_source;
+			}
+		};
+
+		namespace json_details {
+			template<typename>
+			inline constexpr bool is_json_preserved_value_v = false;
+
+			template<typename T>
+			inline constexpr bool
+			  is_json_preserved_value_v<json_preserved_value<T>> = true;
+
+			/***
+			 * Construct a json_preserved_value from the raw JSON text of a member
+			 * with the default parse options.  The parser does not use it, it
+			 * parses the value with the document's policy and records the range
+			 * itself, see parse_value_preserved
+			 */
+			template<typename T>
+			struct preserved_value_constructor;
+		} // namespace json_details
+	}   // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -0,0 +1,93 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include "daw_json_assert.h"
+#include "daw_json_traits.h"
+
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string_view>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/***
+		 * A runtime selection of the members of T to parse.  Passing it to
+		 * from_json parses only the selected members, the others are skipped like
+		 * unknown members and are value initialized in the result.  One mapping
+		 * can serve many query shapes this way.  Members that are not default
+		 * constructible are always parsed.  Only the members of T are projected,
+		 * the members of nested classes are all parsed.
+		 * @tparam T A type mapped with a json_member_list
+		 */
+		template<typename T>
+		class json_projection {
+			using member_list_t = json_data_contract_trait_t<T>;
+
+		public:
+			static constexpr std::size_t member_count = member_list_t::member_count;
+			static constexpr bool is_complete = false;
+
+		private:
+			static constexpr std::size_t word_count =
+			  member_count / 64U + ( member_count % 64U == 0 ? 0U : 1U );
+			std::uint64_t m_words[word_count == 0 ? 1 : word_count] = { };
+
+		public:
+			/// @brief A projection without any members
+			constexpr json_projection( ) = default;
+
+			/// @brief A projection of the members with names
+			constexpr json_projection( std::initializer_list<std::string_view> names ) {
+				for( auto name : names ) {
+					(void)include( name );
+				}
+			}
+
+			/// @brief The position of the member named name in the mapping of T
+			[[nodiscard]] static constexpr std::size_t
+			member_index( std::string_view name ) {
+				std::size_t const result = member_list_t::find_member(
+				  daw::string_view( std::data( name ), std::size( name ) ) );
+				daw_json_ensure( result < member_count, ErrorReason::UnknownMember );
+				return result;
+			}
+
+			constexpr json_projection &include( std::size_t idx ) {
+				daw_json_ensure( idx < member_count, ErrorReason::NumberOutOfRange );
+				m_words[idx / 64U] |= std::uint64_t{ 1 } << ( idx % 64U );
+				return *this;
+			}
+
+			constexpr json_projection &include( std::string_view name ) {
+				return include( member_index( name ) );
+			}
+
+			constexpr json_projection &exclude( std::size_t idx ) {
+				daw_json_ensure( idx < member_count, ErrorReason::NumberOutOfRange );
+				m_words[idx / 64U] &= ~( std::uint64_t{ 1 } << ( idx % 64U ) );
+				return *this;
+			}
+
+			constexpr json_projection &exclude( std::string_view name ) {
+				return exclude( member_index( name ) );
+			}
+
+			/// @brief Is the member at position idx of the mapping parsed
+			[[nodiscard]] constexpr bool contains( std::size_t idx ) const {
+				return ( ( m_words[idx / 64U] >> ( idx % 64U ) ) & 1U ) != 0;
+			}
+		};
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
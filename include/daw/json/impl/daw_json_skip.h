@@ -362,46 +362,6 @@ namespace daw::json {
 				}
 			}
 
-			/***
-			 * Used in json_array_iterator::operator++( ) as we know the type we
-			 * are skipping
-			 */
-			template<typename JsonMember, typename ParseState>
-			[[nodiscard]] DAW_ATTRIB_FLATINLINE static inline constexpr ParseState
-			skip_known_value( ParseState &parse_state ) {
-				daw_json_assert_weak( parse_state.has_more( ),
-				                      ErrorReason::UnexpectedEndOfData, parse_state );
-				if constexpr( JsonMember::expected_type == JsonParseTypes::Date or
-				              JsonMember::expected_type == JsonParseTypes::StringRaw or
-				              JsonMember::expected_type ==
-				                JsonParseTypes::StringEscaped or
-				              JsonMember::expected_type == JsonParseTypes::Custom ) {
-					// json string encodings
-					daw_json_assert_weak( parse_state.front( ) == '"',
-					                      ErrorReason::InvalidString, parse_state );
-					parse_state.remove_prefix( );
-					return json_details::skip_string_nq( parse_state );
-				} else if constexpr( daw::is_any_of_v<
-				                       JsonMember::expected_type, JsonParseTypes::Real,
-				                       JsonParseTypes::Signed, JsonParseTypes::Unsigned,
-				                       JsonParseTypes::Bool, JsonParseTypes::Null> ) {
-					// All literals
-					return skip_number( parse_state );
-				} else if constexpr( JsonMember::expected_type ==
-				                     JsonParseTypes::Array ) {
-					daw_json_assert_weak( parse_state.is_opening_bracket_checked( ),
-					                      ErrorReason::InvalidArrayStart, parse_state );
-					return parse_state.skip_array( );
-				} else if constexpr( JsonMember::expected_type ==
-				                     JsonParseTypes::Class ) {
-					daw_json_assert_weak( parse_state.is_opening_brace_checked( ),
-					                      ErrorReason::InvalidClassStart, parse_state );
-					return parse_state.skip_class( );
-				} else {
-					return skip_value( parse_state );
-				}
-			}
-
 			template<typename ParseState>
 			[[nodiscard]] static inline constexpr ParseState
 			skip_literal( ParseState &parse_state ) {
@@ -438,6 +398,51 @@ namespace daw::json {
 					daw_json_error( ErrorReason::InvalidStartOfValue, parse_state );
 				}
 			}
+
+			/***
+			 * Used in json_array_iterator::operator++( ) as we know the type we
+			 * are skipping.  With KeepQuotes the range of a string includes its
+			 * quotes, as json_lazy needs
+			 */
+			template<typename JsonMember, bool KeepQuotes = false,
+			         typename ParseState>
+			[[nodiscard]] DAW_ATTRIB_FLATINLINE static inline constexpr ParseState
+			skip_known_value( ParseState &parse_state ) {
+				daw_json_assert_weak( parse_state.has_more( ),
+				                      ErrorReason::UnexpectedEndOfData, parse_state );
+				constexpr JsonParseTypes expected_type = JsonMember::expected_type;
+				if constexpr( daw::is_any_of_v<expected_type, JsonParseTypes::Date,
+				                               JsonParseTypes::StringRaw,
+				                               JsonParseTypes::StringEscaped> ) {
+					// json string encodings
+					if constexpr( KeepQuotes ) {
+						return skip_string<true>( parse_state );
+					} else {
+						daw_json_assert_weak( parse_state.front( ) == '"',
+						                      ErrorReason::InvalidString, parse_state );
+						parse_state.remove_prefix( );
+						return json_details::skip_string_nq( parse_state );
+					}
+				} else if constexpr( daw::is_any_of_v<expected_type,
+				                                      JsonParseTypes::Real,
+				                                      JsonParseTypes::Signed,
+				                                      JsonParseTypes::Unsigned> ) {
+					return skip_number( parse_state );
+				} else if constexpr( expected_type == JsonParseTypes::Bool ) {
+					return skip_literal( parse_state );
+				} else if constexpr( expected_type == JsonParseTypes::Array ) {
+					daw_json_assert_weak( parse_state.is_opening_bracket_checked( ),
+					                      ErrorReason::InvalidArrayStart, parse_state );
+					return parse_state.skip_array( );
+				} else if constexpr( expected_type == JsonParseTypes::Class ) {
+					daw_json_assert_weak( parse_state.is_opening_brace_checked( ),
+					                      ErrorReason::InvalidClassStart, parse_state );
+					return parse_state.skip_class( );
+				} else {
+					// Nullable, variant and custom values can take more than one form
+					return skip_value<KeepQuotes>( parse_state );
+				}
+			}
 		} // namespace json_details
 	} // namespace DAW_JSON_VER
 } // namespace daw::json
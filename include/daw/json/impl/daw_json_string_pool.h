@@ -0,0 +1,252 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include "daw_json_assert.h"
+#include "daw_json_parse_common.h"
+#include <daw/json/daw_json_default_constuctor_fwd.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		class json_string_pool;
+
+		/***
+		 * A string stored once in a json_string_pool.  It is a view of the pool's
+		 * copy and is only valid while the pool is.  Strings from the same pool
+		 * compare equal by address.
+		 */
+		class interned_string {
+			std::string_view m_value{ };
+
+			explicit constexpr interned_string( std::string_view value )
+			  : m_value( value ) {}
+
+			friend class json_string_pool;
+
+		public:
+			using i_am_an_interned_string = void;
+			using value_type = char;
+			using const_iterator = std::string_view::const_iterator;
+
+			/// @brief An empty string that is not in any pool
+			constexpr interned_string( ) = default;
+
+			[[nodiscard]] constexpr std::string_view view( ) const {
+				return m_value;
+			}
+
+			[[nodiscard]] constexpr operator std::string_view( ) const {
+				return m_value;
+			}
+
+			[[nodiscard]] constexpr char const *data( ) const {
+				return m_value.data( );
+			}
+
+			[[nodiscard]] constexpr std::size_t size( ) const {
+				return m_value.size( );
+			}
+
+			[[nodiscard]] constexpr bool empty( ) const {
+				return m_value.empty( );
+			}
+
+			[[nodiscard]] constexpr const_iterator begin( ) const {
+				return m_value.begin( );
+			}
+
+			[[nodiscard]] constexpr const_iterator end( ) const {
+				return m_value.end( );
+			}
+
+			[[nodiscard]] friend constexpr bool
+			operator==( interned_string const &lhs, interned_string const &rhs ) {
+				if( lhs.m_value.data( ) == rhs.m_value.data( ) ) {
+					return lhs.m_value.size( ) == rhs.m_value.size( );
+				}
+				// Strings from other pools or default constructed
+				return lhs.m_value == rhs.m_value;
+			}
+
+			[[nodiscard]] friend constexpr bool
+			operator!=( interned_string const &lhs, interned_string const &rhs ) {
+				return not( lhs == rhs );
+			}
+
+			[[nodiscard]] friend constexpr bool
+			operator==( interned_string const &lhs, std::string_view rhs ) {
+				return lhs.m_value == rhs;
+			}
+
+			[[nodiscard]] friend constexpr bool
+			operator!=( interned_string const &lhs, std::string_view rhs ) {
+				return lhs.m_value != rhs;
+			}
+
+			[[nodiscard]] friend constexpr bool
+			operator<( interned_string const &lhs, interned_string const &rhs ) {
+				return lhs.m_value < rhs.m_value;
+			}
+		};
+
+		/***
+		 * A set of strings copied into one arena.  Each distinct string is stored
+		 * once and interning it again returns the same interned_string.  Parse
+		 * with a json_string_pool_scope to intern the interned_string members of
+		 * a document.
+		 */
+		class json_string_pool {
+			std::unordered_set<std::string_view> m_strings{ };
+			std::vector<std::unique_ptr<char[]>> m_blocks{ };
+			char *m_free = nullptr;
+			std::size_t m_free_size = 0;
+			std::size_t m_block_size;
+			std::size_t m_bytes = 0;
+
+			std::string_view store( std::string_view str ) {
+				if( str.size( ) > m_free_size ) {
+					auto const sz = ( std::max )( m_block_size, str.size( ) );
+					m_blocks.push_back( std::make_unique<char[]>( sz ) );
+					m_free = m_blocks.back( ).get( );
+					m_free_size = sz;
+					m_bytes += sz;
+				}
+				auto const result = std::string_view(
+				  std::copy( str.begin( ), str.end( ), m_free ) - str.size( ),
+				  str.size( ) );
+				m_free += str.size( );
+				m_free_size -= str.size( );
+				return result;
+			}
+
+		public:
+			/// @param block_size The size of each allocation of the arena
+			explicit json_string_pool( std::size_t block_size = 4096U )
+			  : m_block_size( block_size == 0 ? 1U : block_size ) {}
+
+			/// @brief The interned copy of str
+			[[nodiscard]] interned_string intern( std::string_view str ) {
+				if( auto pos = m_strings.find( str ); pos != m_strings.end( ) ) {
+					return interned_string( *pos );
+				}
+				auto const result = store( str );
+				m_strings.insert( result );
+				return interned_string( result );
+			}
+
+			/// @brief The number of distinct strings
+			[[nodiscard]] std::size_t size( ) const {
+				return m_strings.size( );
+			}
+
+			/// @brief The bytes allocated by the arena
+			[[nodiscard]] std::size_t arena_size( ) const {
+				return m_bytes;
+			}
+
+			/// @brief Release all strings, the interned_strings of this pool are no
+			/// longer valid
+			void clear( ) {
+				m_strings.clear( );
+				m_blocks.clear( );
+				m_free = nullptr;
+				m_free_size = 0;
+				m_bytes = 0;
+			}
+		};
+
+		namespace json_details {
+			/// @brief The pool of the innermost json_string_pool_scope on this thread
+			[[nodiscard]] inline json_string_pool *&current_string_pool( ) {
+				static thread_local json_string_pool *pool = nullptr;
+				return pool;
+			}
+
+			template<>
+			struct json_deduced_type_map<interned_string> {
+				static constexpr bool is_null = false;
+				static constexpr JsonParseTypes parse_type =
+				  JsonParseTypes::StringEscaped;
+
+				static constexpr bool type_map_found = true;
+			};
+		} // namespace json_details
+
+		/***
+		 * Strings parsed to interned_string on this thread are interned in pool
+		 * until the scope ends.  Scopes can be nested.
+		 */
+		class json_string_pool_scope {
+			json_string_pool *m_previous;
+
+		public:
+			explicit json_string_pool_scope( json_string_pool &pool )
+			  : m_previous(
+			      std::exchange( json_details::current_string_pool( ), &pool ) ) {}
+
+			json_string_pool_scope( json_string_pool_scope const & ) = delete;
+			json_string_pool_scope &
+			operator=( json_string_pool_scope const & ) = delete;
+
+			~json_string_pool_scope( ) {
+				json_details::current_string_pool( ) = m_previous;
+			}
+		};
+
+		/// @brief Intern the unescaped string in the pool of the current
+		/// json_string_pool_scope
+		template<>
+		struct default_constructor<interned_string> {
+			[[nodiscard]] interned_string operator( )( ) const {
+				return interned_string( );
+			}
+
+			[[nodiscard]] interned_string
+			operator( )( interned_string const &value ) const {
+				return value;
+			}
+
+			[[nodiscard]] interned_string operator( )( std::string_view str ) const {
+				auto *pool = json_details::current_string_pool( );
+				daw_json_ensure( pool != nullptr, ErrorReason::MissingStringPool );
+				return pool->intern( str );
+			}
+
+			[[nodiscard]] interned_string operator( )( char const *first,
+			                                           char const *last ) const {
+				return operator( )( std::string_view(
+				  first, static_cast<std::size_t>( last - first ) ) );
+			}
+
+			[[nodiscard]] interned_string operator( )( char const *ptr,
+			                                           std::size_t sz ) const {
+				return operator( )( std::string_view( ptr, sz ) );
+			}
+		};
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
+
+template<>
+struct std::hash<daw::json::interned_string> {
+	[[nodiscard]] std::size_t
+	operator( )( daw::json::interned_string const &str ) const {
+		return std::hash<std::string_view>{ }( str.view( ) );
+	}
+};
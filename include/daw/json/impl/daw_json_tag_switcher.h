@@ -0,0 +1,193 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include "daw_json_name.h"
+
+#include <daw/daw_consteval.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			/// @brief FNV-1a hash of a tag, only computed once per lookup
+			DAW_ATTRIB_INLINE static constexpr std::uint32_t
+			tag_hash( std::string_view tag ) {
+				std::uint32_t hash = 0x811c'9dc5U;
+				for( char c : tag ) {
+					hash ^= static_cast<unsigned char>( c );
+					hash *= 0x0100'0193U;
+				}
+				return hash;
+			}
+
+			/***
+			 * Combine a tag hash with a seed using the murmur3 finalizer, so that the
+			 * low bits used to index the tables are well mixed
+			 */
+			DAW_ATTRIB_INLINE static constexpr std::uint32_t
+			tag_hash_mix( std::uint32_t hash, std::uint32_t seed ) {
+				hash ^= seed * 0x9E37'79B9U;
+				hash ^= hash >> 16U;
+				hash *= 0x85eb'ca6bU;
+				hash ^= hash >> 13U;
+				hash *= 0xc2b2'ae35U;
+				hash ^= hash >> 16U;
+				return hash;
+			}
+
+			/// @brief The smallest power of 2 that is at least twice count
+			static constexpr std::size_t tag_table_size( std::size_t count ) {
+				std::size_t result = 1;
+				while( result < 2 * count ) {
+					result <<= 1U;
+				}
+				return result;
+			}
+
+			/***
+			 * A perfect hash of a fixed set of tags, built with hash and displace.
+			 * The hash of a tag selects a bucket, and the bucket's seed places it in
+			 * a slot of its own.
+			 */
+			template<std::size_t TableSize>
+			struct tag_hash_table_t {
+				static constexpr std::size_t bucket_count = TableSize / 2;
+				std::uint32_t seeds[bucket_count] = { };
+				// Index of the tag + 1, 0 is an empty slot
+				std::size_t slots[TableSize] = { };
+				bool is_valid = true;
+
+				[[nodiscard]] DAW_ATTRIB_INLINE constexpr std::size_t
+				find( std::string_view tag ) const {
+					std::uint32_t const hash = tag_hash( tag );
+					std::uint32_t const seed =
+					  seeds[tag_hash_mix( hash, 0 ) & ( bucket_count - 1U )];
+					return slots[tag_hash_mix( hash, seed ) & ( TableSize - 1U )];
+				}
+			};
+
+			// Should never be called outside a consteval context
+			template<std::size_t TableSize, std::size_t N>
+			DAW_CONSTEVAL tag_hash_table_t<TableSize>
+			make_tag_hash_table( std::string_view const ( &tags )[N] ) {
+				using table_t = tag_hash_table_t<TableSize>;
+				auto result = table_t{ };
+				std::uint32_t hashes[N]{ };
+				std::size_t buckets[N]{ };
+				std::size_t bucket_sizes[table_t::bucket_count]{ };
+				std::size_t max_bucket_size = 0;
+				for( std::size_t n = 0; n < N; ++n ) {
+					for( std::size_t m = 0; m < n; ++m ) {
+						if( tags[m] == tags[n] ) {
+							// Duplicate tags cannot be told apart
+							result.is_valid = false;
+							return result;
+						}
+					}
+					hashes[n] = tag_hash( tags[n] );
+					buckets[n] =
+					  tag_hash_mix( hashes[n], 0 ) & ( table_t::bucket_count - 1U );
+					auto const sz = ++bucket_sizes[buckets[n]];
+					if( sz > max_bucket_size ) {
+						max_bucket_size = sz;
+					}
+				}
+				// Place the largest buckets first, while most slots are free
+				for( std::size_t sz = max_bucket_size; sz > 0; --sz ) {
+					for( std::size_t b = 0; b < table_t::bucket_count; ++b ) {
+						if( bucket_sizes[b] != sz ) {
+							continue;
+						}
+						bool is_placed = false;
+						for( std::uint32_t seed = 1; seed < 0x1'0000U and not is_placed;
+						     ++seed ) {
+							std::size_t slots[TableSize]{ };
+							for( std::size_t n = 0; n < TableSize; ++n ) {
+								slots[n] = result.slots[n];
+							}
+							is_placed = true;
+							for( std::size_t n = 0; n < N and is_placed; ++n ) {
+								if( buckets[n] != b ) {
+									continue;
+								}
+								auto const slot =
+								  tag_hash_mix( hashes[n], seed ) & ( TableSize - 1U );
+								if( slots[slot] != 0 ) {
+									is_placed = false;
+								} else {
+									slots[slot] = n + 1;
+								}
+							}
+							if( is_placed ) {
+								result.seeds[b] = seed;
+								for( std::size_t n = 0; n < TableSize; ++n ) {
+									result.slots[n] = slots[n];
+								}
+							}
+						}
+						if( not is_placed ) {
+							result.is_valid = false;
+							return result;
+						}
+					}
+				}
+				return result;
+			}
+		} // namespace json_details
+
+		/***
+		 * A Switcher for json_tagged_variant and json_intrusive_variant with string
+		 * tags. The tag is found with a compile time perfect hash and a single
+		 * string compare instead of comparing it against each tag in turn.  The
+		 * index returned is the position of the tag in Tags, or tag_count when
+		 * the tag is unknown and the parse will fail.
+		 * To serialize, derive from it and add the operator that gets the tag
+		 * from the parent class, tag_at can map the alternative index back to its
+		 * tag.
+		 * @tparam Tags The tag of each alternative, in the alternatives order
+		 */
+		template<JSONNAMETYPE... Tags>
+		struct json_string_tag_switcher {
+			static_assert( sizeof...( Tags ) > 0,
+			               "At least one tag is required to switch on" );
+
+			static constexpr std::size_t tag_count = sizeof...( Tags );
+			static constexpr std::string_view tags[] = { std::string_view( Tags )... };
+
+		private:
+			static constexpr std::size_t table_size =
+			  json_details::tag_table_size( tag_count );
+			static constexpr auto table =
+			  json_details::make_tag_hash_table<table_size>( tags );
+			static_assert( table.is_valid,
+			               "Tags must be unique to build a perfect hash of them" );
+
+		public:
+			[[nodiscard]] constexpr std::size_t
+			operator( )( std::string_view tag ) const {
+				std::size_t const slot = table.find( tag );
+				if( slot == 0 or tags[slot - 1] != tag ) {
+					return tag_count;
+				}
+				return slot - 1;
+			}
+
+			/// @brief The tag of the alternative at idx
+			[[nodiscard]] static constexpr std::string_view tag_at( std::size_t idx ) {
+				return tags[idx];
+			}
+		};
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
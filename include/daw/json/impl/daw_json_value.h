@@ -504,7 +504,9 @@ namespace daw::json {
 			template<typename Result>
 			[[nodiscard]] constexpr auto as( ) const {
 				using result_t = json_details::json_deduced_type<Result>;
-				auto state = m_parse_state;
+				auto state = json_details::reread_parse_state_t<ParseState>(
+				  m_parse_state.first, m_parse_state.last, m_parse_state.class_first,
+				  m_parse_state.class_last, m_parse_state.get_allocator( ) );
 				return json_details::parse_value<result_t, false,
 				                                 result_t::expected_type>( state );
 			}
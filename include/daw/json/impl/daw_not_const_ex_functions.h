@@ -116,9 +116,39 @@ namespace daw::json {
 				return to_uint32( _mm_movemask_epi8( found ) );
 			}
 
+			/***
+			 * Copy 16 byte blocks from first to out until a block contains one of
+			 * keys.  Only the characters before the key are copied from that block,
+			 * so nothing past the returned out is written.  out may alias the input
+			 * as long as it does not pass first, the bytes from the key on are not
+			 * read yet and must not be overwritten.
+			 * @return The position of the first key found, or the start of the
+			 * remaining partial block
+			 */
+			template<char... keys, typename CharT>
+			DAW_ATTRIB_INLINE CharT *mem_copy_to_next_of( sse42_exec_tag tag,
+			                                              CharT *first,
+			                                              CharT *const last,
+			                                              char *&out ) {
+				while( last - first >= 16 ) {
+					auto const val0 = uload16_char_data( tag, first );
+					auto const key_positions = ( mem_find_eq<keys>( tag, val0 ) | ... );
+					if( key_positions != 0 ) {
+						auto const pos = find_lsb_set( tag, key_positions );
+						memmove( out, first, static_cast<std::size_t>( pos ) );
+						out += pos;
+						return first + pos;
+					}
+					_mm_storeu_si128( reinterpret_cast<__m128i *>( out ), val0 );
+					first += 16;
+					out += 16;
+				}
+				return first;
+			}
+
 			template<unsigned char k>
 			DAW_ATTRIB_INLINE UInt32 mem_find_gt( sse42_exec_tag, __m128i block ) {
-				static __m128i const keys = _mm_set1_epi8( k );
+				__m128i const keys = _mm_set1_epi8( static_cast<char>( k ) );
 				__m128i const found = _mm_cmpgt_epi8( block, keys );
 				return to_uint32( _mm_movemask_epi8( found ) );
 			}
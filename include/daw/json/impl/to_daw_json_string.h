@@ -11,7 +11,9 @@
 #include "version.h"
 
 #include "daw_json_assert.h"
+#include "daw_json_lazy_value.h"
 #include "daw_json_parse_iso8601_utils.h"
+#include "daw_json_preserved_value.h"
 #include "daw_json_serialize_options_impl.h"
 #include "daw_json_serialize_policy.h"
 #include "daw_json_value.h"
@@ -43,10 +45,26 @@
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
 		namespace json_details {
-			template<typename WriteableType, typename Real>
-			static constexpr WriteableType
-			to_chars( options::FPOutputFormat fp_output_format, Real const &value,
-			          WriteableType out_it );
+			/***
+			 * Upper bound on the characters fp_to_chars writes for a finite value,
+			 * including the sign.  Decimal output of a double can need a few hundred
+			 * zeros, Auto and Scientific never exceed the shortest round trip digits
+			 * plus exponent
+			 */
+			template<typename Real, options::FPOutputFormat fp_output_format>
+			inline constexpr std::size_t fp_max_chars_v =
+			  fp_output_format == options::FPOutputFormat::Decimal
+			    ? ( sizeof( Real ) <= sizeof( float ) ? 64U : 352U )
+			    : 32U;
+
+			template<options::FPOutputFormat fp_output_format, typename Real>
+			[[nodiscard]] static inline char *fp_to_chars( Real const &value,
+			                                               char *ptr );
+
+			template<options::FPOutputFormat fp_output_format,
+			         typename WriteableType, typename Real>
+			static constexpr WriteableType to_chars( Real const &value,
+			                                         WriteableType out_it );
 		} // namespace json_details
 
 		namespace json_details::to_strings {
@@ -600,7 +618,7 @@ namespace daw::json {
 				}
 				if constexpr( daw::is_floating_point_v<parse_to_t> ) {
 					static_assert( sizeof( parse_to_t ) <= sizeof( double ) );
-					it = to_chars( JsonMember::fp_output_format, value, it );
+					it = to_chars<JsonMember::fp_output_format>( value, it );
 				} else {
 					using std::to_string;
 					using to_strings::to_string;
@@ -912,8 +930,23 @@ namespace daw::json {
 			template<typename JsonMember, typename WriteableType, typename parse_to_t>
 			[[nodiscard]] static inline constexpr WriteableType
 			to_json_string_unknown( WriteableType it, parse_to_t const &value ) {
-
-				return utils::copy_to_iterator( it, value );
+				if constexpr( is_json_preserved_value_v<parse_to_t> or
+				              is_json_lazy_value_v<parse_to_t> ) {
+					if( value.is_dirty( ) ) {
+						using value_member_t =
+						  json_deduced_type<typename parse_to_t::value_type>;
+						return to_daw_json_string<value_member_t,
+						                          value_member_t::expected_type>(
+						  it, value.value( ) );
+					}
+					// Unmodified since parsing, the original text is still valid JSON
+					auto const source = value.source( );
+					it.copy_buffer( std::data( source ),
+					                std::data( source ) + std::size( source ) );
+					return it;
+				} else {
+					return utils::copy_to_iterator( it, value );
+				}
 			}
 
 			template<typename JsonMember, typename WriteableType, typename parse_to_t>
@@ -1062,6 +1095,69 @@ namespace daw::json {
 			                    (void)( std::end( std::declval<T &>( ) ) ),
 			                    (void)( std::declval<typename T::value_type>( ) ) ) );
 
+			/***
+			 * Minified arrays of float/double are formatted into a local buffer in
+			 * one loop, numbers and separators alike, and flushed to the output in
+			 * large blocks instead of a write per value and per comma.  float
+			 * elements are formatted as binary32 and never widened to double
+			 */
+			template<typename JsonMember, typename WriteableType,
+			         json_options_t SerializationOptions, typename parse_to_t>
+			[[nodiscard]] static serialization_policy<WriteableType,
+			                                          SerializationOptions>
+			to_json_string_real_array(
+			  serialization_policy<WriteableType, SerializationOptions> it,
+			  parse_to_t const &value ) {
+
+				using element_t = typename JsonMember::json_element_t;
+				using real_t = daw::remove_cvref_t<decltype( *std::begin( value ) )>;
+				constexpr auto fp_output_format = element_t::fp_output_format;
+				// Room for the longest value and its separator
+				constexpr std::size_t max_element_size =
+				  fp_max_chars_v<real_t, fp_output_format> + 1U;
+				constexpr std::size_t buffer_size = 4096U;
+				static_assert( buffer_size > max_element_size + 2U );
+
+				char buff[buffer_size];
+				char *ptr = buff;
+				char const *const flush_point = buff + ( buffer_size - max_element_size );
+
+				*ptr++ = '[';
+				auto first = std::begin( value );
+				auto const last = std::end( value );
+				bool const has_elements = first != last;
+				while( first != last ) {
+					real_t const v = *first;
+					if( DAW_LIKELY( daw::jkj::dragonbox::ieee754_bits( v ).is_finite( ) ) ) {
+						ptr = fp_to_chars<fp_output_format>( v, ptr );
+					} else {
+						// NaN/Inf are either an error or a string depending on the member
+						// options.  Let the regular path decide
+						it.copy_buffer( buff, ptr );
+						ptr = buff;
+						it = to_daw_json_string<element_t, element_t::expected_type>( it,
+						                                                              v );
+					}
+					++first;
+					if( first != last ) {
+						*ptr++ = ',';
+					}
+					if( ptr >= flush_point ) {
+						it.copy_buffer( buff, ptr );
+						ptr = buff;
+					}
+				}
+				if constexpr( it.output_trailing_comma ==
+				              options::OutputTrailingComma::Yes ) {
+					if( has_elements ) {
+						*ptr++ = ',';
+					}
+				}
+				*ptr++ = ']';
+				it.copy_buffer( buff, ptr );
+				return it;
+			}
+
 			template<typename JsonMember, typename WriteableType,
 			         json_options_t SerializationOptions, typename parse_to_t>
 			[[nodiscard]] static constexpr serialization_policy<WriteableType,
@@ -1090,6 +1186,20 @@ namespace daw::json {
 					  "Container like type, but std::span like types work too" );
 				}
 
+				using element_t = typename JsonMember::json_element_t;
+				if constexpr( element_t::expected_type == JsonParseTypes::Real and
+				              serialization_policy<WriteableType, SerializationOptions>::
+				                  serialization_format ==
+				                options::SerializationFormat::Minified ) {
+					using real_t = daw::remove_cvref_t<decltype( *std::begin( value ) )>;
+					if constexpr( ( std::is_same_v<real_t, float> or
+					                std::is_same_v<real_t, double> ) and
+					              element_t::literal_as_string !=
+					                options::LiteralAsStringOpt::Always ) {
+						return to_json_string_real_array<JsonMember>( it, value );
+					}
+				}
+
 				it.put( '[' );
 				it.add_indent( );
 				auto first = std::begin( value );
@@ -1469,20 +1579,45 @@ namespace daw::json {
 				}
 			}
 
-			template<typename WriteableType, typename Real>
-			static constexpr WriteableType
-			to_chars( options::FPOutputFormat fp_output_format, Real const &value,
-			          WriteableType out_it ) {
+			template<typename Unsigned>
+			DAW_ATTRIB_INLINE static char *fp_write_digits( char *ptr, Unsigned value ) {
+				auto v = static_cast<std::make_unsigned_t<Unsigned>>( value );
+				if( v == 0 ) {
+					*ptr++ = '0';
+					return ptr;
+				}
+				char *const first = ptr;
+				while( v >= 10 ) {
+					auto const tmp = static_cast<std::size_t>( v % 100U );
+					v /= 100U;
+					ptr[0] = digits100[tmp][0];
+					ptr[1] = digits100[tmp][1];
+					ptr += 2;
+				}
+				if( v > 0 ) {
+					*ptr++ = static_cast<char>( '0' + static_cast<char>( v ) );
+				}
+				reverse( first, ptr );
+				return ptr;
+			}
+
+			/***
+			 * Write the shortest round trip representation of a finite value to ptr.
+			 * The caller must supply at least fp_max_chars_v<Real, fp_output_format>
+			 * characters
+			 * @return One past the last character written
+			 */
+			template<options::FPOutputFormat fp_output_format, typename Real>
+			[[nodiscard]] static inline char *fp_to_chars( Real const &value,
+			                                               char *ptr ) {
 				daw::jkj::dragonbox::unsigned_fp_t<Real> dec =
 				  daw::jkj::dragonbox::to_decimal(
 				    value, daw::jkj::dragonbox::policy::sign::ignore );
 
-				auto const digits =
-				  daw::jkj::dragonbox::to_chars_detail::decimal_length(
-				    dec.significand );
-
-				auto whole_dig = static_cast<std::int32_t>( digits ) + dec.exponent;
-
+				if( dec.significand == 0 ) {
+					*ptr++ = '0';
+					return ptr;
+				}
 				auto const br = [&] {
 					if constexpr( std::is_same_v<Real, float> ) {
 						return daw::jkj::dragonbox::ieee754_bits( value );
@@ -1491,70 +1626,73 @@ namespace daw::json {
 						  static_cast<double>( value ) );
 					}
 				}( );
-				if( dec.significand == 0 ) {
-					out_it.put( '0' );
-					return out_it;
-				}
 				if( br.is_negative( ) ) {
-					out_it.put( '-' );
-				}
-				if( fp_output_format == options::FPOutputFormat::Scientific ) {
-					char buff[50]{ };
-					char *ptr = buff;
-					ptr =
-					  daw::jkj::dragonbox::to_chars_detail::to_chars( dec, ptr, digits );
-					out_it.copy_buffer( buff, ptr );
-					return out_it;
-				} else if( fp_output_format == options::FPOutputFormat::Auto ) {
-					if( ( whole_dig < -4 ) | ( whole_dig > 6 ) ) {
-						char buff[50]{ };
-						char *ptr = buff;
-						ptr = daw::jkj::dragonbox::to_chars_detail::to_chars( dec, ptr,
-						                                                      digits );
-						out_it.copy_buffer( buff, ptr );
-						return out_it;
-					}
+					*ptr++ = '-';
 				}
-				if( dec.exponent < 0 ) {
-					if( whole_dig < 0 ) {
-						out_it.write( "0." );
-						do {
-							out_it.put( '0' );
-							++whole_dig;
-						} while( whole_dig < 0 );
-						out_it = utils::integer_to_string( out_it, dec.significand );
-						return out_it;
-					}
-					// TODO allow for decimal output for all
-					auto const p1pow =
-					  daw::cxmath::pow10( static_cast<std::size_t>( -dec.exponent ) );
-					auto const p1val = dec.significand / p1pow;
-					out_it = utils::integer_to_string( out_it, p1val );
-					if( p1pow == 1 ) {
-						return out_it;
+
+				auto const digits =
+				  daw::jkj::dragonbox::to_chars_detail::decimal_length(
+				    dec.significand );
+
+				if constexpr( fp_output_format == options::FPOutputFormat::Scientific ) {
+					return daw::jkj::dragonbox::to_chars_detail::to_chars( dec, ptr,
+					                                                       digits );
+				} else {
+					auto whole_dig = static_cast<std::int32_t>( digits ) + dec.exponent;
+					if constexpr( fp_output_format == options::FPOutputFormat::Auto ) {
+						if( ( whole_dig < -4 ) | ( whole_dig > 6 ) ) {
+							return daw::jkj::dragonbox::to_chars_detail::to_chars( dec, ptr,
+							                                                       digits );
+						}
 					}
-					out_it.put( '.' );
-					auto const p2val = dec.significand - ( p1val * p1pow );
-					// ensure we account for leading zeros
-					//					auto const sig_sigits =
-					{
-						auto const l10_sig = daw::cxmath::count_digits( dec.significand );
-						auto const l10_p1val = daw::cxmath::count_digits( p1val );
-						auto const l10_p2val = daw::cxmath::count_digits( p2val );
-						auto const extra_zeros = l10_sig - ( l10_p2val + l10_p1val );
-						for( int n = 0; n < extra_zeros; ++n ) {
-							out_it.put( '0' );
+					if( dec.exponent < 0 ) {
+						if( whole_dig < 0 ) {
+							*ptr++ = '0';
+							*ptr++ = '.';
+							do {
+								*ptr++ = '0';
+								++whole_dig;
+							} while( whole_dig < 0 );
+							return fp_write_digits( ptr, dec.significand );
+						}
+						// TODO allow for decimal output for all
+						auto const p1pow =
+						  daw::cxmath::pow10( static_cast<std::size_t>( -dec.exponent ) );
+						auto const p1val = dec.significand / p1pow;
+						ptr = fp_write_digits( ptr, p1val );
+						if( p1pow == 1 ) {
+							return ptr;
+						}
+						*ptr++ = '.';
+						auto const p2val = dec.significand - ( p1val * p1pow );
+						// ensure we account for leading zeros
+						{
+							auto const l10_sig = daw::cxmath::count_digits( dec.significand );
+							auto const l10_p1val = daw::cxmath::count_digits( p1val );
+							auto const l10_p2val = daw::cxmath::count_digits( p2val );
+							auto const extra_zeros = l10_sig - ( l10_p2val + l10_p1val );
+							for( int n = 0; n < extra_zeros; ++n ) {
+								*ptr++ = '0';
+							}
 						}
+						return fp_write_digits( ptr, p2val );
 					}
-					out_it = utils::integer_to_string( out_it, p2val );
-					return out_it;
+					ptr = fp_write_digits( ptr, dec.significand );
+					while( dec.exponent > 0 ) {
+						*ptr++ = '0';
+						--dec.exponent;
+					}
+					return ptr;
 				}
-				out_it = utils::integer_to_string( out_it, dec.significand );
+			}
 
-				while( dec.exponent > 0 ) {
-					out_it.put( '0' );
-					--dec.exponent;
-				}
+			template<options::FPOutputFormat fp_output_format,
+			         typename WriteableType, typename Real>
+			static constexpr WriteableType to_chars( Real const &value,
+			                                         WriteableType out_it ) {
+				char buff[fp_max_chars_v<Real, fp_output_format>]{ };
+				char const *const last = fp_to_chars<fp_output_format>( value, buff );
+				out_it.copy_buffer( buff, last );
 				return out_it;
 			}
 		} // namespace json_details
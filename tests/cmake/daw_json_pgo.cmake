@@ -0,0 +1,67 @@
+# Copyright (c) Darrell Wright
+#
+# Distributed under the Boost Software License, Version 1.0. (See accompanying
+# file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+#
+# Official repository: https://github.com/beached/daw_json_link
+#
+# Run with cmake -P by the daw_json_pgo target.  Builds daw_json_bench_std_alloc
+# plain, instrumented and with the profile gathered from running it over
+# test_data, then compares the plain and PGO results with json_bench_viewer.
+#
+# Expects SOURCE_DIR, PGO_BINARY_DIR, TEST_DATA_DIR, CXX_COMPILER, COMPILER_ID,
+# and optionally LLVM_PROFDATA and USE_PACKAGE_MANAGEMENT to be defined
+
+set( _bench_target daw_json_bench_std_alloc )
+set( _profile_dir "${PGO_BINARY_DIR}/profile" )
+set( _baseline_dir "${PGO_BINARY_DIR}/baseline" )
+set( _pgo_dir "${PGO_BINARY_DIR}/pgo" )
+set( _baseline_results "${PGO_BINARY_DIR}/baseline_results.json" )
+set( _training_results "${PGO_BINARY_DIR}/training_results.json" )
+set( _pgo_results "${PGO_BINARY_DIR}/pgo_results.json" )
+
+function( daw_json_pgo_run )
+	execute_process( COMMAND ${ARGN} RESULT_VARIABLE _result )
+	if( _result )
+		message( FATAL_ERROR "Failed(${_result}): ${ARGN}" )
+	endif()
+endfunction()
+
+function( daw_json_pgo_build build_dir pgo_mode )
+	message( STATUS "Building ${build_dir} with DAW_JSON_PGO=${pgo_mode}" )
+	daw_json_pgo_run( ${CMAKE_COMMAND} -S "${SOURCE_DIR}" -B "${build_dir}"
+	                  -DCMAKE_BUILD_TYPE=Release
+	                  "-DCMAKE_CXX_COMPILER=${CXX_COMPILER}"
+	                  -DDAW_ENABLE_TESTING=ON
+	                  "-DDAW_USE_PACKAGE_MANAGEMENT=${USE_PACKAGE_MANAGEMENT}"
+	                  "-DDAW_JSON_PGO=${pgo_mode}"
+	                  "-DDAW_JSON_PGO_DIR=${_profile_dir}" )
+	daw_json_pgo_run( ${CMAKE_COMMAND} --build "${build_dir}" --parallel
+	                  --target ${_bench_target} json_bench_viewer )
+endfunction()
+
+file( REMOVE_RECURSE "${_profile_dir}" )
+file( REMOVE "${_baseline_results}" "${_training_results}" "${_pgo_results}" )
+
+daw_json_pgo_build( "${_baseline_dir}" OFF )
+daw_json_pgo_run( "${_baseline_dir}/tests/${_bench_target}" "${TEST_DATA_DIR}" "${_baseline_results}" )
+
+daw_json_pgo_build( "${_pgo_dir}" GENERATE )
+daw_json_pgo_run( "${_pgo_dir}/tests/${_bench_target}" "${TEST_DATA_DIR}" "${_training_results}" )
+
+if( COMPILER_ID STREQUAL "Clang" OR COMPILER_ID STREQUAL "AppleClang" )
+	if( NOT LLVM_PROFDATA )
+		message( FATAL_ERROR "llvm-profdata is required to merge the clang profile" )
+	endif()
+	file( GLOB _raw_profiles "${_profile_dir}/*.profraw" )
+	daw_json_pgo_run( "${LLVM_PROFDATA}" merge "-output=${_profile_dir}/daw_json.profdata" ${_raw_profiles} )
+endif()
+
+# Reuse the instrumented build directory so that gcc finds the .gcda files
+daw_json_pgo_build( "${_pgo_dir}" USE )
+daw_json_pgo_run( "${_pgo_dir}/tests/${_bench_target}" "${TEST_DATA_DIR}" "${_pgo_results}" )
+
+# A regression here means PGO made that cell slower, so it is reported but
+# does not fail the target
+message( STATUS "Gain of PGO per dataset and parse options, negative is faster" )
+execute_process( COMMAND "${_baseline_dir}/tests/json_bench_viewer" "${_baseline_results}" "${_pgo_results}" )
@@ -256,3 +256,30 @@ else()
 	message( STATUS "Unknown compiler id ${CMAKE_CXX_COMPILER_ID}" )
 endif()
 
+# Profile guided optimization, see the daw_json_pgo target for the full cycle
+set( DAW_JSON_PGO "OFF" CACHE STRING "Profile guided optimization of the tests and benchmarks: OFF, GENERATE or USE" )
+set_property( CACHE DAW_JSON_PGO PROPERTY STRINGS OFF GENERATE USE )
+set( DAW_JSON_PGO_DIR "${CMAKE_BINARY_DIR}/pgo_profile" CACHE PATH "The directory the PGO profile is written to and read from" )
+if( NOT DAW_JSON_PGO STREQUAL "OFF" )
+	if( ( ${CMAKE_CXX_COMPILER_ID} STREQUAL "Clang" OR ${CMAKE_CXX_COMPILER_ID} STREQUAL "AppleClang" ) AND NOT MSVC )
+		if( DAW_JSON_PGO STREQUAL "GENERATE" )
+			add_compile_options( "-fprofile-instr-generate=${DAW_JSON_PGO_DIR}/%p.profraw" )
+			add_link_options( "-fprofile-instr-generate=${DAW_JSON_PGO_DIR}/%p.profraw" )
+		else()
+			# The profile is merged with llvm-profdata into daw_json.profdata
+			add_compile_options( "-fprofile-instr-use=${DAW_JSON_PGO_DIR}/daw_json.profdata" -Wno-profile-instr-unprofiled -Wno-profile-instr-out-of-date )
+		endif()
+	elseif( ${CMAKE_CXX_COMPILER_ID} STREQUAL "GNU" )
+		if( DAW_JSON_PGO STREQUAL "GENERATE" )
+			add_compile_options( "-fprofile-generate=${DAW_JSON_PGO_DIR}" )
+			add_link_options( "-fprofile-generate=${DAW_JSON_PGO_DIR}" )
+		else()
+			# The .gcda names are derived from the object paths, so USE must be
+			# built in the same build directory as GENERATE
+			add_compile_options( "-fprofile-use=${DAW_JSON_PGO_DIR}" -fprofile-partial-training -Wno-missing-profile )
+		endif()
+	else()
+		message( WARNING "DAW_JSON_PGO is not supported with ${CMAKE_CXX_COMPILER_ID}" )
+	endif()
+	message( STATUS "DAW_JSON_PGO=${DAW_JSON_PGO}: profile in ${DAW_JSON_PGO_DIR}" )
+endif()
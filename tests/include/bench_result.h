@@ -8,10 +8,16 @@
 
 #pragma once
 
+#include "defines.h"
+
+#include <daw/daw_read_file.h>
 #include <daw/json/daw_json_link.h>
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
+#include <fstream>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -19,6 +25,23 @@
 namespace daw::bench {
 	using timestamp_t = std::chrono::time_point<std::chrono::system_clock,
 	                                            std::chrono::milliseconds>;
+
+	/// Hardware performance counters averaged over the runs of a benchmark
+	struct perf_counter_result {
+		double cycles;
+		double instructions;
+		double branch_misses;
+		double l1d_misses;
+		double llc_misses;
+	};
+
+	/// The tail of the per call latencies of many small documents
+	struct tail_latency_result {
+		std::chrono::nanoseconds p50;
+		std::chrono::nanoseconds p99;
+		std::chrono::nanoseconds p999;
+	};
+
 	struct bench_result {
 		std::string name;
 		timestamp_t test_time;
@@ -38,6 +61,8 @@ namespace daw::bench {
 		std::string build_type;
 		std::string project_name;
 		std::string project_subname;
+		std::optional<perf_counter_result> perf_counters{ };
+		std::optional<tail_latency_result> tail_latency{ };
 	};
 } // namespace daw::bench
 
@@ -63,6 +88,40 @@ namespace daw::json {
 	using json_nanosecond_no_name =
 	  json_custom_lit_no_name<std::chrono::nanoseconds, JSONToNano, JSONToNano>;
 
+	template<>
+	struct json_data_contract<daw::bench::perf_counter_result> {
+		static inline constexpr char const cycles[] = "cycles";
+		static inline constexpr char const instructions[] = "instructions";
+		static inline constexpr char const branch_misses[] = "branch_misses";
+		static inline constexpr char const l1d_misses[] = "l1d_misses";
+		static inline constexpr char const llc_misses[] = "llc_misses";
+		using type =
+		  json_member_list<json_number<cycles>, json_number<instructions>,
+		                   json_number<branch_misses>, json_number<l1d_misses>,
+		                   json_number<llc_misses>>;
+
+		[[nodiscard]] static inline auto
+		to_json_data( daw::bench::perf_counter_result const &value ) {
+			return std::forward_as_tuple( value.cycles, value.instructions,
+			                              value.branch_misses, value.l1d_misses,
+			                              value.llc_misses );
+		}
+	};
+
+	template<>
+	struct json_data_contract<daw::bench::tail_latency_result> {
+		static inline constexpr char const p50[] = "p50";
+		static inline constexpr char const p99[] = "p99";
+		static inline constexpr char const p999[] = "p999";
+		using type = json_member_list<json_nanosecond<p50>, json_nanosecond<p99>,
+		                              json_nanosecond<p999>>;
+
+		[[nodiscard]] static inline auto
+		to_json_data( daw::bench::tail_latency_result const &value ) {
+			return std::forward_as_tuple( value.p50, value.p99, value.p999 );
+		}
+	};
+
 	template<>
 	struct json_data_contract<daw::bench::bench_result> {
 		static inline constexpr char const name[] = "name";
@@ -87,6 +146,8 @@ namespace daw::json {
 		static inline constexpr char const build_type[] = "build_type";
 		static inline constexpr char const project_name[] = "project_name";
 		static inline constexpr char const project_subname[] = "project_subname";
+		static inline constexpr char const perf_counters[] = "perf_counters";
+		static inline constexpr char const tail_latency[] = "tail_latency";
 		using type = json_member_list<
 		  json_string<name>, json_date<test_time>,
 		  json_number<data_size, std::size_t>,
@@ -97,7 +158,11 @@ namespace daw::json {
 		  json_string<git_revision>, json_string<processor_description>,
 		  json_string<os_name>, json_string<os_release>, json_string<os_version>,
 		  json_string<os_platform>, json_string<build_type>,
-		  json_string<project_name>, json_string<project_subname>>;
+		  json_string<project_name>, json_string<project_subname>,
+		  json_class_null<perf_counters,
+		                  std::optional<daw::bench::perf_counter_result>>,
+		  json_class_null<tail_latency,
+		                  std::optional<daw::bench::tail_latency_result>>>;
 
 		[[nodiscard]] static inline auto
 		to_json_data( daw::bench::bench_result const &value ) {
@@ -107,7 +172,104 @@ namespace daw::json {
 			  value.duration_50th_percentile, value.duration_75th_percentile,
 			  value.duration_max, value.git_revision, value.processor_description,
 			  value.os_name, value.os_release, value.os_version, value.os_platform,
-			  value.build_type, value.project_name, value.project_subname );
+			  value.build_type, value.project_name, value.project_subname,
+			  value.perf_counters, value.tail_latency );
 		}
 	};
 } // namespace daw::json
+
+namespace daw::bench {
+	/// The run time at p, from 0 to 1, of the sorted run times
+	inline std::chrono::nanoseconds
+	percentile( std::vector<std::chrono::nanoseconds> const &sorted, double p ) {
+		auto const idx = static_cast<std::size_t>(
+		  p * static_cast<double>( sorted.size( ) - 1U ) );
+		return sorted[idx];
+	}
+
+#if defined( SOURCE_CONTROL_REVISION )
+// The benchmark executables get these from the build system along with
+// SOURCE_CONTROL_REVISION
+#if not defined( PROCESSOR_DESCRIPTION )
+#error "PROCESSOR_DESCRIPTION must be defined"
+#endif
+#if not defined( OS_NAME )
+#error "OS_NAME must be defined"
+#endif
+#if not defined( OS_RELEASE )
+#error "OS_RELEASE must be defined"
+#endif
+#if not defined( OS_VERSION )
+#error "OS_VERSION must be defined"
+#endif
+#if not defined( OS_PLATFORM )
+#error "OS_PLATFORM must be defined"
+#endif
+#if not defined( BUILD_TYPE )
+#error "BUILD_TYPE must be defined"
+#endif
+
+	/// A result of the run times stamped with the revision and machine it was
+	/// built on.  run_times must not be empty
+	inline bench_result
+	make_bench_result( std::string name, std::size_t data_size,
+	                   std::vector<std::chrono::nanoseconds> run_times,
+	                   std::string project_subname ) {
+		auto result = bench_result{
+		  std::move( name ),
+		  std::chrono::time_point_cast<std::chrono::milliseconds>(
+		    std::chrono::system_clock::now( ) ),
+		  data_size,
+		  std::move( run_times ),
+		  { },
+		  { },
+		  { },
+		  { },
+		  { },
+		  SOURCE_CONTROL_REVISION,
+		  PROCESSOR_DESCRIPTION,
+		  OS_NAME,
+		  OS_RELEASE,
+		  OS_VERSION,
+		  OS_PLATFORM,
+		  BUILD_TYPE,
+		  "daw_json_link",
+		  std::move( project_subname ) };
+
+		auto runs = result.run_times;
+		std::sort( runs.begin( ), runs.end( ) );
+		result.duration_min = runs.front( );
+		result.duration_max = runs.back( );
+		result.duration_25th_percentile = percentile( runs, 0.25 );
+		result.duration_50th_percentile = percentile( runs, 0.50 );
+		result.duration_75th_percentile = percentile( runs, 0.75 );
+		return result;
+	}
+#endif
+
+	/// Add results to the array of results in the file at path, creating it
+	/// when it does not exist yet
+	inline void append_results( std::string const &path,
+	                            std::vector<bench_result> const &results ) {
+		std::string out_data{ };
+		{
+			auto const json_data_results_file = daw::read_file( path );
+			auto old_results = [&]( ) -> std::vector<bench_result> {
+				if( not json_data_results_file or
+				    json_data_results_file->size( ) < 2U ) {
+					return { };
+				}
+				return daw::json::from_json_array<bench_result>(
+				  *json_data_results_file );
+			}( );
+			old_results.insert( old_results.end( ), results.begin( ),
+			                    results.end( ) );
+			out_data = daw::json::to_json_array( old_results );
+		}
+
+		auto out_file = std::ofstream( path, std::ios::out | std::ios::trunc );
+		test_assert( out_file, "Could not open the results file" );
+		out_file.write( out_data.data( ),
+		                static_cast<std::streamsize>( out_data.size( ) ) );
+	}
+} // namespace daw::bench
@@ -0,0 +1,108 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// The mapped datasets in test_data used by the benchmark matrix.  The models
+// for the fixed allocator share their names with the std::allocator ones, so
+// define DAW_JSON_BENCH_FIXED_ALLOC to use them instead.
+//
+
+#pragma once
+
+#if defined( DAW_JSON_BENCH_FIXED_ALLOC )
+#include "citm_test_json_alloc.h"
+#include "geojson_alloc.h"
+#include "twitter_test_alloc_json.h"
+#else
+#include "apache_builds_json.h"
+#include "citm_test_json.h"
+#include "geojson_json.h"
+#include "twitter_test_json.h"
+#endif
+
+#include <daw/json/daw_from_json.h>
+
+#include <string>
+#include <string_view>
+
+namespace daw::bench {
+#if defined( DAW_JSON_BENCH_FIXED_ALLOC )
+	using AllocType = daw::fixed_allocator<char>;
+	inline constexpr std::string_view allocator_name = "fixed";
+
+	inline AllocType &bench_allocator( ) {
+		static auto alloc = AllocType( 50'000'000ULL );
+		return alloc;
+	}
+
+	template<typename T, typename... MemberPath, auto... PolicyFlags>
+	auto parse_dataset( std::string const &json_doc,
+	                    daw::json::options::parse_flags_t<PolicyFlags...> policy,
+	                    MemberPath... member_path ) {
+		auto &alloc = bench_allocator( );
+		alloc.release( );
+		return daw::json::from_json_alloc<T>( json_doc, member_path..., alloc,
+		                                      policy );
+	}
+#else
+	inline constexpr std::string_view allocator_name = "std";
+
+	template<typename T, typename... MemberPath, auto... PolicyFlags>
+	auto parse_dataset( std::string const &json_doc,
+	                    daw::json::options::parse_flags_t<PolicyFlags...> policy,
+	                    MemberPath... member_path ) {
+		return daw::json::from_json<T>( json_doc, member_path..., policy );
+	}
+
+	struct apache_builds_dataset {
+		static constexpr std::string_view file_name = "apache_builds.json";
+
+		template<typename Policy>
+		static auto parse( std::string const &json_doc, Policy policy ) {
+			return parse_dataset<apache_builds::apache_builds>( json_doc, policy );
+		}
+	};
+#endif
+
+	struct twitter_dataset {
+		static constexpr std::string_view file_name = "twitter.json";
+
+		template<typename Policy>
+		static auto parse( std::string const &json_doc, Policy policy ) {
+			return parse_dataset<daw::twitter::twitter_object_t>( json_doc, policy );
+		}
+	};
+
+	struct citm_dataset {
+		static constexpr std::string_view file_name = "citm_catalog.json";
+
+		template<typename Policy>
+		static auto parse( std::string const &json_doc, Policy policy ) {
+			return parse_dataset<daw::citm::citm_object_t>( json_doc, policy );
+		}
+	};
+
+	struct canada_dataset {
+		static constexpr std::string_view file_name = "canada.json";
+
+		template<typename Policy>
+		static auto parse( std::string const &json_doc, Policy policy ) {
+			return parse_dataset<daw::geojson::Polygon>( json_doc, policy,
+			                                             "features[0].geometry" );
+		}
+	};
+
+	/// Call func with each dataset available in this build
+	template<typename Func>
+	void for_each_dataset( Func &&func ) {
+#if not defined( DAW_JSON_BENCH_FIXED_ALLOC )
+		func( apache_builds_dataset{ } );
+#endif
+		func( twitter_dataset{ } );
+		func( citm_dataset{ } );
+		func( canada_dataset{ } );
+	}
+} // namespace daw::bench
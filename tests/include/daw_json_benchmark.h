@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include "daw_json_perf_counters.h"
+
 #include <daw/daw_do_not_optimize.h>
 #include <daw/daw_expected.h>
 #include <daw/daw_string_view.h>
@@ -320,6 +322,25 @@ namespace daw::json::benchmark {
 		}
 		auto const full_finish = std::chrono::steady_clock::now( );
 
+		// The counters are read in a pass of their own so that starting and
+		// stopping them is not part of the times above
+		auto counters = perf_counters( );
+		auto counter_totals = perf_counter_values( );
+		if( counters.is_available( ) ) {
+			for( std::size_t n = 0; n < min_num_runs * 2; ++n ) {
+				counters.start( );
+				daw::do_not_optimize( data );
+#if defined( DAW_USE_EXCEPTIONS )
+				try {
+#endif
+					fnc( data );
+#if defined( DAW_USE_EXCEPTIONS )
+				} catch( ... ) {}
+#endif
+				counter_totals += counters.stop( );
+			}
+		}
+
 		auto const base_duration = base_finish - base_start;
 		auto const run_duration = ( full_finish - full_start ) - base_duration;
 		auto const avg_duration = run_duration / min_num_runs;
@@ -358,7 +379,33 @@ namespace daw::json::benchmark {
 		          << " items/s\n";
 		std::cout << "total time: " << ns_to_string( run_duration, 2 )
 		          << "\tdata size: " << to_min_SI_unit( data_size )
-		          << "B\tnumber of runs: " << min_num_runs << "\n\n";
+		          << "B\tnumber of runs: " << min_num_runs << '\n';
+		if( counters.is_available( ) ) {
+			auto const total_runs = static_cast<double>( min_num_runs * 2 );
+			auto const per_run = [&]( std::uint64_t total ) {
+				return static_cast<double>( total ) / total_runs;
+			};
+			auto const old_precision = std::cout.precision( 2 );
+			std::cout << "cycles/run: "
+			          << to_min_SI_unit( per_run( counter_totals.cycles ), 2 )
+			          << "\tinstructions/run: "
+			          << to_min_SI_unit( per_run( counter_totals.instructions ), 2 );
+			if( counter_totals.cycles > 0 ) {
+				std::cout << "\tIPC: " << counter_totals.ipc( ) << "\tbytes/cycle: "
+				          << ( static_cast<double>( data_size ) /
+				               per_run( counter_totals.cycles ) );
+			}
+			std::cout << '\n';
+			std::cout << "branch misses/run: "
+			          << to_min_SI_unit( per_run( counter_totals.branch_misses ), 2 )
+			          << "\tL1d misses/run: "
+			          << to_min_SI_unit( per_run( counter_totals.l1d_misses ), 2 )
+			          << "\tLLC misses/run: "
+			          << to_min_SI_unit( per_run( counter_totals.llc_misses ), 2 )
+			          << '\n';
+			std::cout.precision( old_precision );
+		}
+		std::cout << '\n';
 
 #if defined( DAW_USE_EXCEPTIONS )
 		try {
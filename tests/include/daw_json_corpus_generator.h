@@ -0,0 +1,205 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Generates twitter documents of a chosen shape from a seed document.  The
+// statuses are resized and their text replaced before to_json, then the
+// serialized document is mutated to shuffle members and add deeply nested
+// unknown members.
+//
+
+#pragma once
+
+#include "twitter_test_json.h"
+
+#include <daw/json/daw_to_json.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace daw::json::benchmark {
+	struct corpus_options {
+		/// @brief The number of statuses, the seed's are repeated as needed
+		std::size_t status_count = 100;
+		/// @brief The length of each status's text, 0 keeps the seed's length
+		std::size_t text_length = 0;
+		/// @brief The fraction of text characters that must be escaped
+		double escape_density = 0.0;
+		/// @brief The probability that the members of an object are shuffled
+		double shuffle_probability = 0.0;
+		/// @brief When not 0, each status gets an unmapped member with arrays
+		/// nested this deep that the parser must skip
+		std::size_t unknown_depth = 0;
+		std::uint32_t seed = 1;
+	};
+
+	namespace corpus_details {
+		inline std::string make_text( std::size_t length, double escape_density,
+		                              std::mt19937 &rng ) {
+			static constexpr std::string_view plain_chars =
+			  "abcdefghijklmnopqrstuvwxyz ABCDEFGHIJKLMNOPQRSTUVWXYZ 0123456789";
+			static constexpr std::string_view escaped_chars = "\"\\\n\t\r\b\f";
+			auto is_escaped = std::bernoulli_distribution( escape_density );
+			auto plain = std::uniform_int_distribution<std::size_t>(
+			  0, plain_chars.size( ) - 1U );
+			auto escaped = std::uniform_int_distribution<std::size_t>(
+			  0, escaped_chars.size( ) - 1U );
+			auto result = std::string( );
+			result.reserve( length );
+			for( std::size_t n = 0; n < length; ++n ) {
+				result.push_back( is_escaped( rng ) ? escaped_chars[escaped( rng )]
+				                                    : plain_chars[plain( rng )] );
+			}
+			return result;
+		}
+
+		enum class value_kind { root, statuses, status, other };
+
+		/// Rewrites the minified output of to_json, shuffling members and
+		/// adding the unknown members to the statuses
+		class member_mutator {
+			std::string_view m_doc;
+			std::size_t m_pos = 0;
+			corpus_options const &m_opts;
+			std::mt19937 &m_rng;
+
+			std::string_view string_token( ) {
+				auto const first = m_pos++;
+				while( m_doc[m_pos] != '"' ) {
+					m_pos += m_doc[m_pos] == '\\' ? 2U : 1U;
+				}
+				++m_pos;
+				return m_doc.substr( first, m_pos - first );
+			}
+
+			std::string_view scalar_token( ) {
+				auto const first = m_pos;
+				while( m_pos < m_doc.size( ) and m_doc[m_pos] != ',' and
+				       m_doc[m_pos] != ']' and m_doc[m_pos] != '}' ) {
+					++m_pos;
+				}
+				return m_doc.substr( first, m_pos - first );
+			}
+
+			std::string unknown_member( ) const {
+				auto result = std::string( "\"synthetic_nested\":" );
+				result.append( m_opts.unknown_depth, '[' );
+				result += '1';
+				result.append( m_opts.unknown_depth, ']' );
+				return result;
+			}
+
+			std::string object( value_kind kind ) {
+				auto members = std::vector<std::string>( );
+				if( kind == value_kind::status and m_opts.unknown_depth > 0 ) {
+					members.push_back( unknown_member( ) );
+				}
+				++m_pos;
+				while( m_doc[m_pos] != '}' ) {
+					auto const name = string_token( );
+					++m_pos;
+					auto const child_kind = kind == value_kind::root and
+					                            name == R"("statuses")"
+					                          ? value_kind::statuses
+					                          : value_kind::other;
+					auto member = std::string( name );
+					member += ':';
+					member += value( child_kind );
+					members.push_back( std::move( member ) );
+					if( m_doc[m_pos] == ',' ) {
+						++m_pos;
+					}
+				}
+				++m_pos;
+				if( std::bernoulli_distribution( m_opts.shuffle_probability )(
+				      m_rng ) ) {
+					std::shuffle( members.begin( ), members.end( ), m_rng );
+				}
+				auto result = std::string( "{" );
+				for( auto const &member : members ) {
+					if( result.size( ) > 1U ) {
+						result += ',';
+					}
+					result += member;
+				}
+				result += '}';
+				return result;
+			}
+
+			std::string array( value_kind kind ) {
+				auto const child_kind =
+				  kind == value_kind::statuses ? value_kind::status : value_kind::other;
+				auto result = std::string( "[" );
+				++m_pos;
+				while( m_doc[m_pos] != ']' ) {
+					result += value( child_kind );
+					if( m_doc[m_pos] == ',' ) {
+						result += ',';
+						++m_pos;
+					}
+				}
+				++m_pos;
+				result += ']';
+				return result;
+			}
+
+		public:
+			member_mutator( std::string_view doc, corpus_options const &opts,
+			                std::mt19937 &rng )
+			  : m_doc( doc )
+			  , m_opts( opts )
+			  , m_rng( rng ) {}
+
+			std::string value( value_kind kind ) {
+				switch( m_doc[m_pos] ) {
+				case '{':
+					return object( kind );
+				case '[':
+					return array( kind );
+				case '"':
+					return std::string( string_token( ) );
+				default:
+					return std::string( scalar_token( ) );
+				}
+			}
+		};
+	} // namespace corpus_details
+
+	/***
+	 * Generate a twitter document shaped by opts, repeating the statuses of
+	 * seed_doc.  The same options and seed always produce the same document
+	 */
+	inline std::string
+	generate_twitter_corpus( daw::twitter::twitter_object_t const &seed_doc,
+	                         corpus_options const &opts ) {
+		auto rng = std::mt19937( opts.seed );
+		auto doc = daw::twitter::twitter_object_t{ { }, seed_doc.search_metadata };
+		doc.statuses.reserve( opts.status_count );
+		for( std::size_t n = 0; n < opts.status_count and
+		                        not seed_doc.statuses.empty( );
+		     ++n ) {
+			doc.statuses.push_back(
+			  seed_doc.statuses[n % seed_doc.statuses.size( )] );
+			auto &text = doc.statuses.back( ).text;
+			if( opts.text_length > 0 or opts.escape_density > 0.0 ) {
+				auto const length =
+				  opts.text_length > 0 ? opts.text_length : text.size( );
+				text = corpus_details::make_text( length, opts.escape_density, rng );
+			}
+		}
+		auto json_doc = daw::json::to_json( doc );
+		if( opts.shuffle_probability <= 0.0 and opts.unknown_depth == 0 ) {
+			return json_doc;
+		}
+		return corpus_details::member_mutator( json_doc, opts, rng )
+		  .value( corpus_details::value_kind::root );
+	}
+} // namespace daw::json::benchmark
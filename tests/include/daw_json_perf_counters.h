@@ -0,0 +1,179 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#if defined( DAW_JSON_PERF_COUNTERS ) and defined( __linux__ )
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#define DAW_JSON_HAS_PERF_COUNTERS
+#endif
+
+namespace daw::json::benchmark {
+	/// @brief Hardware counter totals of one or more measured regions
+	struct perf_counter_values {
+		std::uint64_t cycles = 0;
+		std::uint64_t instructions = 0;
+		std::uint64_t branch_misses = 0;
+		std::uint64_t l1d_misses = 0;
+		std::uint64_t llc_misses = 0;
+
+		constexpr perf_counter_values &
+		operator+=( perf_counter_values const &rhs ) {
+			cycles += rhs.cycles;
+			instructions += rhs.instructions;
+			branch_misses += rhs.branch_misses;
+			l1d_misses += rhs.l1d_misses;
+			llc_misses += rhs.llc_misses;
+			return *this;
+		}
+
+		/// @brief Instructions per cycle
+		[[nodiscard]] constexpr double ipc( ) const {
+			if( cycles == 0 ) {
+				return 0.0;
+			}
+			return static_cast<double>( instructions ) /
+			       static_cast<double>( cycles );
+		}
+	};
+
+#if defined( DAW_JSON_HAS_PERF_COUNTERS )
+	/***
+	 * Counts cycles, instructions, branch misses, L1d read misses and LLC read
+	 * misses of this thread in user space with perf_event_open.  When the
+	 * kernel refuses the counters, e.g. because of
+	 * /proc/sys/kernel/perf_event_paranoid, is_available( ) is false and
+	 * stop( ) returns zeros.
+	 */
+	class perf_counters {
+		static constexpr std::size_t counter_count = 5;
+		// File descriptors in the order of the members of perf_counter_values
+		std::array<int, counter_count> m_fds{ -1, -1, -1, -1, -1 };
+		// The position of each counter in a group read, if it was opened
+		std::array<int, counter_count> m_read_index{ -1, -1, -1, -1, -1 };
+		std::size_t m_opened = 0;
+
+		static constexpr std::uint64_t cache_read_miss( std::uint64_t cache ) {
+			return cache | ( PERF_COUNT_HW_CACHE_OP_READ << 8U ) |
+			       ( PERF_COUNT_HW_CACHE_RESULT_MISS << 16U );
+		}
+
+		static int open_counter( std::uint32_t type, std::uint64_t config,
+		                         int group_fd ) {
+			auto attr = perf_event_attr{ };
+			attr.size = sizeof( perf_event_attr );
+			attr.type = type;
+			attr.config = config;
+			attr.disabled = group_fd == -1 ? 1U : 0U;
+			attr.exclude_kernel = 1U;
+			attr.exclude_hv = 1U;
+			attr.read_format = PERF_FORMAT_GROUP;
+			return static_cast<int>(
+			  syscall( SYS_perf_event_open, &attr, 0, -1, group_fd, 0UL ) );
+		}
+
+	public:
+		perf_counters( ) {
+			static constexpr std::array<std::uint32_t, counter_count> types = {
+			  PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE,
+			  PERF_TYPE_HW_CACHE, PERF_TYPE_HW_CACHE };
+			static constexpr std::array<std::uint64_t, counter_count> configs = {
+			  PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+			  PERF_COUNT_HW_BRANCH_MISSES,
+			  cache_read_miss( PERF_COUNT_HW_CACHE_L1D ),
+			  cache_read_miss( PERF_COUNT_HW_CACHE_LL ) };
+
+			for( std::size_t n = 0; n < counter_count; ++n ) {
+				m_fds[n] = open_counter( types[n], configs[n], m_fds[0] );
+				if( m_fds[n] >= 0 ) {
+					m_read_index[n] = static_cast<int>( m_opened++ );
+				} else if( n == 0 ) {
+					// Without cycles there is no group to join
+					return;
+				}
+			}
+		}
+
+		perf_counters( perf_counters const & ) = delete;
+		perf_counters &operator=( perf_counters const & ) = delete;
+
+		~perf_counters( ) {
+			for( int fd : m_fds ) {
+				if( fd >= 0 ) {
+					close( fd );
+				}
+			}
+		}
+
+		[[nodiscard]] bool is_available( ) const {
+			return m_fds[0] >= 0;
+		}
+
+		/// @brief Reset and start counting
+		void start( ) {
+			if( not is_available( ) ) {
+				return;
+			}
+			ioctl( m_fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP );
+			ioctl( m_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP );
+		}
+
+		/// @brief Stop counting
+		/// @return The counts since start( )
+		perf_counter_values stop( ) {
+			auto result = perf_counter_values{ };
+			if( not is_available( ) ) {
+				return result;
+			}
+			ioctl( m_fds[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP );
+			// The number of counters followed by their values
+			std::array<std::uint64_t, counter_count + 1> buff{ };
+			auto const bytes_read = read( m_fds[0], buff.data( ), sizeof( buff ) );
+			if( bytes_read < static_cast<ssize_t>( sizeof( std::uint64_t ) ) ) {
+				return result;
+			}
+			auto const value = [&]( std::size_t n ) -> std::uint64_t {
+				if( m_read_index[n] < 0 or
+				    static_cast<std::uint64_t>( m_read_index[n] ) >= buff[0] ) {
+					return 0;
+				}
+				return buff[static_cast<std::size_t>( m_read_index[n] ) + 1U];
+			};
+			result.cycles = value( 0 );
+			result.instructions = value( 1 );
+			result.branch_misses = value( 2 );
+			result.l1d_misses = value( 3 );
+			result.llc_misses = value( 4 );
+			return result;
+		}
+	};
+#else
+	/// @brief Performance counters are disabled, define DAW_JSON_PERF_COUNTERS
+	/// on Linux to enable them
+	class perf_counters {
+	public:
+		[[nodiscard]] constexpr bool is_available( ) const {
+			return false;
+		}
+
+		constexpr void start( ) {}
+
+		[[nodiscard]] constexpr perf_counter_values stop( ) {
+			return { };
+		}
+	};
+#endif
+} // namespace daw::json::benchmark
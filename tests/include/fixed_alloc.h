@@ -111,6 +111,7 @@ namespace daw {
 		unsigned char *buffer_start;
 		unsigned char *ptr;
 		std::size_t capacity;
+		std::size_t allocation_count = 0;
 
 		fixed_allocator_impl( std::size_t Size )
 		  : buffer_start( new unsigned char[Size] )
@@ -163,6 +164,7 @@ namespace daw {
 
 			T *r = reinterpret_cast<T *>( m_data->ptr );
 			m_data->ptr += n * sizeof( T );
+			++m_data->allocation_count;
 			return r;
 		}
 
@@ -171,6 +173,7 @@ namespace daw {
 		void constexpr release( ) noexcept {
 			assert( m_data->buffer_start and m_data->ptr );
 			m_data->ptr = m_data->buffer_start;
+			m_data->allocation_count = 0;
 		}
 
 		[[nodiscard]] constexpr std::size_t used( ) const {
@@ -179,6 +182,13 @@ namespace daw {
 			return static_cast<std::size_t>( m_data->ptr - m_data->buffer_start );
 		}
 
+		/// @brief The number of calls to allocate since construction or the last
+		/// release( )
+		[[nodiscard]] constexpr std::size_t allocations( ) const {
+			assert( m_data->ptr and m_data->buffer_start );
+			return m_data->allocation_count;
+		}
+
 		template<typename>
 		friend class daw::fixed_allocator;
 
@@ -0,0 +1,211 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Generate worst case documents at two sizes and check that the time per byte
+// does not grow with the size, i.e. that none of them hit a quadratic path.
+// Pass a directory to also write the large documents there as a corpus for
+// the fuzzers.
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_event_parser.h>
+#include <daw/json/daw_json_link.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct adversarial_point {
+	int x;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<adversarial_point> {
+		static constexpr char const x[] = "x";
+		using type = json_member_list<json_number<x, int>>;
+	};
+} // namespace daw::json
+
+inline namespace {
+	// The large document is size_factor times the small one.  A linear parser
+	// keeps the time per byte about the same, a quadratic one multiplies it by
+	// about size_factor
+	constexpr std::size_t size_factor = 16;
+	constexpr double max_per_byte_growth = 4.0;
+	constexpr std::size_t timing_runs = 5;
+
+	struct adversarial_case {
+		std::string_view name;
+		std::size_t small_count;
+		std::string ( *make )( std::size_t count );
+		void ( *parse )( std::string const &json_doc );
+	};
+
+	std::string repeat( std::string_view s, std::size_t count ) {
+		auto result = std::string( );
+		result.reserve( s.size( ) * count );
+		for( std::size_t n = 0; n < count; ++n ) {
+			result += s;
+		}
+		return result;
+	}
+
+	struct nesting_counter {
+		std::size_t arrays = 0;
+
+		template<typename JsonValue>
+		bool handle_on_array_start( JsonValue ) {
+			++arrays;
+			return true;
+		}
+	};
+
+	void parse_point( std::string const &json_doc ) {
+		auto const p = daw::json::from_json<adversarial_point>( json_doc );
+		test_assert( p.x == 1, "Expected x to be 1" );
+	}
+
+	std::vector<adversarial_case> const &adversarial_cases( ) {
+		static auto const result = std::vector<adversarial_case>{
+		  // Grows the stack of DefaultJsonEventParserStackPolicy
+		  { "deep_nesting_event_parser", 8'000,
+		    []( std::size_t count ) {
+			    return repeat( "[", count ) + repeat( "]", count );
+		    },
+		    []( std::string const &json_doc ) {
+			    auto handler = nesting_counter{ };
+			    daw::json::json_event_parser( json_doc, handler );
+			    test_assert( handler.arrays * 2U == json_doc.size( ),
+			                 "Expected every array to be visited" );
+		    } },
+		  // skip_value over deeply nested unknown members
+		  { "deep_nesting_skipped", 32'000,
+		    []( std::size_t count ) {
+			    return R"({"skip":)" + repeat( "[{\"a\":", count ) + "1" +
+			           repeat( "}]", count ) + R"(,"x":1})";
+		    },
+		    parse_point },
+		  // Thousands of members that are not mapped before the one that is
+		  { "unknown_members", 2'000,
+		    []( std::size_t count ) {
+			    auto result = std::string( "{" );
+			    for( std::size_t n = 0; n < count; ++n ) {
+				    result += "\"u" + std::to_string( n ) +
+				              R"(":[1,"a\"b",{"c":null,"d":[true,false]}],)";
+			    }
+			    return result + R"("x":1})";
+		    },
+		    parse_point },
+		  // Long runs of \u escapes, including surrogate pairs
+		  { "unicode_escapes", 4'000,
+		    []( std::size_t count ) {
+			    return '"' + repeat( R"(\u00e9\ud83d\ude00\u4e2d)", count ) + '"';
+		    },
+		    []( std::string const &json_doc ) {
+			    auto const s = daw::json::from_json<std::string>( json_doc );
+			    test_assert( not s.empty( ), "Expected a string" );
+		    } },
+		  // Mantissas with thousands of digits fall back to parse_with_strtod
+		  { "long_numbers", 64,
+		    []( std::size_t count ) {
+			    auto result = std::string( "[" );
+			    for( std::size_t n = 0; n < count; ++n ) {
+				    if( n > 0 ) {
+					    result += ',';
+				    }
+				    result += "1." + repeat( "1234567890", 100 ) + "e-5";
+			    }
+			    return result + ']';
+		    },
+		    []( std::string const &json_doc ) {
+			    auto const v = daw::json::from_json<std::vector<double>>( json_doc );
+			    test_assert( not v.empty( ), "Expected numbers" );
+		    } },
+		  { "long_number", 1'000,
+		    []( std::size_t count ) {
+			    return "1." + repeat( "1234567890", count );
+		    },
+		    []( std::string const &json_doc ) {
+			    auto const d = daw::json::from_json<double>( json_doc );
+			    test_assert( d > 1.0 and d < 2.0, "Expected 1.1234..." );
+		    } } };
+		return result;
+	}
+
+	/// The fastest of timing_runs parses in nanoseconds per byte
+	double ns_per_byte( adversarial_case const &c, std::string const &json_doc ) {
+		auto best = std::chrono::nanoseconds::max( );
+		for( std::size_t n = 0; n < timing_runs; ++n ) {
+			auto const start = std::chrono::steady_clock::now( );
+			c.parse( json_doc );
+			auto const elapsed =
+			  std::chrono::duration_cast<std::chrono::nanoseconds>(
+			    std::chrono::steady_clock::now( ) - start );
+			best = std::min( best, elapsed );
+		}
+		return static_cast<double>( best.count( ) ) /
+		       static_cast<double>( json_doc.size( ) );
+	}
+} // namespace
+
+int main( int argc, char **argv )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	bool is_linear = true;
+	for( auto const &c : adversarial_cases( ) ) {
+		auto const small_doc = c.make( c.small_count );
+		auto const large_doc = c.make( c.small_count * size_factor );
+		if( argc > 1 ) {
+			auto const file_name = std::string( argv[1] ) + '/' +
+			                       std::string( c.name ) + ".json";
+			auto out_file = std::ofstream( file_name, std::ios::trunc );
+			test_assert( out_file, "Could not open the corpus file" );
+			out_file.write( large_doc.data( ),
+			                static_cast<std::streamsize>( large_doc.size( ) ) );
+		}
+		// Warm up the caches and allocator
+		c.parse( small_doc );
+
+		auto const small_ns = ns_per_byte( c, small_doc );
+		auto const large_ns = ns_per_byte( c, large_doc );
+		auto const growth = large_ns / small_ns;
+		bool const ok = growth <= max_per_byte_growth;
+		is_linear = is_linear and ok;
+		std::cout << ( ok ? "ok:     " : "FAILED: " ) << c.name << ' '
+		          << small_doc.size( ) << " bytes " << small_ns << "ns/byte, "
+		          << large_doc.size( ) << " bytes " << large_ns
+		          << "ns/byte, growth " << growth << "x\n";
+	}
+	if( not is_linear ) {
+		std::cerr << "Time per byte grew more than " << max_per_byte_growth
+		          << "x for a " << size_factor << "x larger document\n";
+		return EXIT_FAILURE;
+	}
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,267 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Count the heap allocations of from_json and to_json for every mapped
+// dataset in test_data.  The global operator new/delete are replaced with
+// counting versions and, when built with DAW_JSON_BENCH_FIXED_ALLOC, the
+// policy Allocator's arena is reported too.
+//
+
+#include "defines.h"
+
+#include "daw_json_bench_datasets.h"
+
+#include <daw/daw_read_file.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+namespace {
+	struct heap_counters {
+		std::size_t allocations = 0;
+		std::size_t bytes_allocated = 0;
+		std::size_t live_bytes = 0;
+		std::size_t peak_live_bytes = 0;
+	};
+
+	// Single threaded, so there is no need for atomics
+	heap_counters global_heap_counters{ };
+
+	// Each block is prefixed with its size so that the unsized deletes can
+	// update the live bytes
+	constexpr std::size_t header_size = alignof( std::max_align_t );
+	static_assert( header_size >= sizeof( std::size_t ) );
+
+	void *counted_allocate( std::size_t size ) {
+		auto *block = static_cast<unsigned char *>(
+		  std::malloc( size + header_size ) );
+		if( block == nullptr ) {
+#if defined( DAW_USE_EXCEPTIONS )
+			throw std::bad_alloc( );
+#else
+			std::abort( );
+#endif
+		}
+		*reinterpret_cast<std::size_t *>( block ) = size;
+		auto &counters = global_heap_counters;
+		++counters.allocations;
+		counters.bytes_allocated += size;
+		counters.live_bytes += size;
+		if( counters.live_bytes > counters.peak_live_bytes ) {
+			counters.peak_live_bytes = counters.live_bytes;
+		}
+		return block + header_size;
+	}
+
+	void counted_deallocate( void *ptr ) noexcept {
+		if( ptr == nullptr ) {
+			return;
+		}
+		auto *block = static_cast<unsigned char *>( ptr ) - header_size;
+		global_heap_counters.live_bytes -=
+		  *reinterpret_cast<std::size_t *>( block );
+		std::free( block );
+	}
+} // namespace
+
+// Over aligned allocations keep the default operators and are not counted, none
+// of the models use them
+void *operator new( std::size_t size ) {
+	return counted_allocate( size );
+}
+
+void *operator new[]( std::size_t size ) {
+	return counted_allocate( size );
+}
+
+void operator delete( void *ptr ) noexcept {
+	counted_deallocate( ptr );
+}
+
+void operator delete[]( void *ptr ) noexcept {
+	counted_deallocate( ptr );
+}
+
+void operator delete( void *ptr, std::size_t ) noexcept {
+	counted_deallocate( ptr );
+}
+
+void operator delete[]( void *ptr, std::size_t ) noexcept {
+	counted_deallocate( ptr );
+}
+
+struct alloc_profile_result {
+	std::string name;
+	std::size_t data_size = 0;
+	std::size_t allocations = 0;
+	std::size_t bytes_allocated = 0;
+	std::size_t peak_live_bytes = 0;
+	std::size_t policy_allocations = 0;
+	std::size_t policy_bytes_allocated = 0;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<alloc_profile_result> {
+		static inline constexpr char const name[] = "name";
+		static inline constexpr char const data_size[] = "data_size";
+		static inline constexpr char const allocations[] = "allocations";
+		static inline constexpr char const bytes_allocated[] = "bytes_allocated";
+		static inline constexpr char const peak_live_bytes[] = "peak_live_bytes";
+		static inline constexpr char const policy_allocations[] =
+		  "policy_allocations";
+		static inline constexpr char const policy_bytes_allocated[] =
+		  "policy_bytes_allocated";
+
+		using type = json_member_list<
+		  json_string<name>, json_number<data_size, std::size_t>,
+		  json_number<allocations, std::size_t>,
+		  json_number<bytes_allocated, std::size_t>,
+		  json_number<peak_live_bytes, std::size_t>,
+		  json_number<policy_allocations, std::size_t>,
+		  json_number<policy_bytes_allocated, std::size_t>>;
+
+		static inline auto to_json_data( alloc_profile_result const &value ) {
+			return std::forward_as_tuple(
+			  value.name, value.data_size, value.allocations, value.bytes_allocated,
+			  value.peak_live_bytes, value.policy_allocations,
+			  value.policy_bytes_allocated );
+		}
+	};
+} // namespace daw::json
+
+namespace {
+	using namespace daw::bench;
+
+	/// Counts the heap use from construction until stop( ), the peak is
+	/// relative to what was live at the start
+	class heap_profile {
+		heap_counters m_start = global_heap_counters;
+
+	public:
+		heap_profile( ) {
+			global_heap_counters.peak_live_bytes = global_heap_counters.live_bytes;
+		}
+
+		void stop( alloc_profile_result &result ) const {
+			auto const &now = global_heap_counters;
+			result.allocations = now.allocations - m_start.allocations;
+			result.bytes_allocated = now.bytes_allocated - m_start.bytes_allocated;
+			result.peak_live_bytes = now.peak_live_bytes - m_start.live_bytes;
+		}
+	};
+
+	void show_result( alloc_profile_result const &result ) {
+		auto const mb = static_cast<double>( result.data_size ) / 1'000'000.0;
+		std::cout << result.name << ": " << result.allocations << " allocations ("
+		          << std::fixed << std::setprecision( 1 )
+		          << ( static_cast<double>( result.allocations ) / mb )
+		          << "/MB), " << result.bytes_allocated << " bytes, peak live "
+		          << result.peak_live_bytes << " bytes";
+		if( result.policy_allocations > 0 ) {
+			std::cout << ", policy allocator " << result.policy_allocations
+			          << " allocations " << result.policy_bytes_allocated
+			          << " bytes";
+		}
+		std::cout << '\n';
+	}
+
+	template<typename Dataset>
+	void profile_dataset( std::string const &test_data_path,
+	                      std::vector<alloc_profile_result> &results ) {
+		auto const file_name =
+		  test_data_path + '/' + std::string( Dataset::file_name );
+		auto const json_doc = daw::read_file( file_name );
+		if( not json_doc or json_doc->size( ) < 2U ) {
+			std::cerr << "Skipping " << file_name << ", it could not be read\n";
+			return;
+		}
+		constexpr auto policy = daw::json::options::parse_flags<>;
+		auto const name_prefix = std::string( Dataset::file_name );
+		auto const name_suffix =
+		  "(allocator=" + std::string( allocator_name ) + ')';
+
+		// Warm up so that one time allocations, like the arena of the fixed
+		// allocator, are not counted against the document
+		(void)daw::json::to_json( Dataset::parse( *json_doc, policy ) );
+
+		auto parsed = [&] {
+			auto from_result = alloc_profile_result{
+			  name_prefix + " from_json" + name_suffix, json_doc->size( ) };
+			auto const profile = heap_profile( );
+			auto result = Dataset::parse( *json_doc, policy );
+			profile.stop( from_result );
+#if defined( DAW_JSON_BENCH_FIXED_ALLOC )
+			from_result.policy_allocations = bench_allocator( ).allocations( );
+			from_result.policy_bytes_allocated = bench_allocator( ).used( );
+#endif
+			show_result( from_result );
+			results.push_back( std::move( from_result ) );
+			return result;
+		}( );
+
+		auto to_result = alloc_profile_result{
+		  name_prefix + " to_json" + name_suffix, json_doc->size( ) };
+		{
+			auto const profile = heap_profile( );
+			auto const json_out = daw::json::to_json( parsed );
+			profile.stop( to_result );
+			test_assert( not json_out.empty( ), "Expected a serialized document" );
+		}
+		show_result( to_result );
+		results.push_back( std::move( to_result ) );
+	}
+} // namespace
+
+int main( int argc, char **argv )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	if( argc < 2 ) {
+		std::cerr << "Must supply the path to test_data and optionally a file to "
+		             "write the results to\n";
+		exit( 1 );
+	}
+	auto const test_data_path = std::string( argv[1] );
+	auto results = std::vector<alloc_profile_result>{ };
+
+	for_each_dataset( [&]( auto dataset ) {
+		profile_dataset<decltype( dataset )>( test_data_path, results );
+	} );
+
+	if( argc < 3 ) {
+		return EXIT_SUCCESS;
+	}
+	auto const out_data = daw::json::to_json_array( results );
+	auto out_file = std::ofstream( argv[2], std::ios::out | std::ios::trunc );
+	test_assert( out_file, "Could not open the results file" );
+	out_file.write( out_data.data( ),
+	                static_cast<std::streamsize>( out_data.size( ) ) );
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,244 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Benchmark every mapped dataset in test_data across the cross product of
+// the exec mode, checked, zero terminated and minified parse options.  The
+// allocator axis is selected at build time with DAW_JSON_BENCH_FIXED_ALLOC and
+// the daw_json_bench target runs both builds.
+//
+
+#include "defines.h"
+
+#include "bench_result.h"
+#include "daw_json_bench_datasets.h"
+#include "daw_json_perf_counters.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/daw_read_file.h>
+#include <daw/daw_utility.h>
+#include <daw/json/daw_from_json.h>
+#include <daw/json/daw_to_json.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 100;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+using namespace daw::json::options;
+
+inline namespace {
+	using namespace daw::bench;
+
+	template<auto... Values, typename Func>
+	constexpr void for_each_value( Func &&func ) {
+		( func( std::integral_constant<decltype( Values ), Values>{ } ), ... );
+	}
+
+	constexpr std::string_view to_string( CheckedParseMode mode ) {
+		return mode == CheckedParseMode::yes ? "yes" : "no";
+	}
+
+	constexpr std::string_view to_string( ZeroTerminatedString mode ) {
+		return mode == ZeroTerminatedString::yes ? "yes" : "no";
+	}
+
+	constexpr std::string_view to_string( MinifiedDocument mode ) {
+		return mode == MinifiedDocument::yes ? "yes" : "no";
+	}
+
+	/// Remove the whitespace between tokens so that the MinifiedDocument::yes
+	/// cells have a document they can parse
+	std::string minify( std::string_view json_doc ) {
+		auto result = std::string( );
+		result.reserve( json_doc.size( ) );
+		bool in_string = false;
+		bool is_escaped = false;
+		for( char c : json_doc ) {
+			if( in_string ) {
+				if( is_escaped ) {
+					is_escaped = false;
+				} else if( c == '\\' ) {
+					is_escaped = true;
+				} else if( c == '"' ) {
+					in_string = false;
+				}
+			} else if( c == '"' ) {
+				in_string = true;
+			} else if( c == ' ' or c == '\t' or c == '\n' or c == '\r' ) {
+				continue;
+			}
+			result.push_back( c );
+		}
+		return result;
+	}
+
+	void show_result( daw::bench::bench_result const &result ) {
+		auto const min_ts =
+		  std::chrono::duration<double>( result.duration_min ).count( );
+		std::cout << result.name << ": "
+		          << daw::utility::to_bytes_per_second(
+		               static_cast<double>( result.data_size ) / min_ts, 1.0, 2 )
+		          << "/s";
+		if( result.perf_counters and result.perf_counters->cycles > 0.0 ) {
+			std::cout << " IPC: "
+			          << ( result.perf_counters->instructions /
+			               result.perf_counters->cycles )
+			          << " bytes/cycle: "
+			          << ( static_cast<double>( result.data_size ) /
+			               result.perf_counters->cycles );
+		}
+		std::cout << '\n';
+	}
+
+	/// Read the counters over DAW_NUM_RUNS parses of their own, the timed runs
+	/// do not pay for starting and stopping them
+	template<typename Dataset, typename ParseFlags>
+	std::optional<daw::bench::perf_counter_result>
+	measure_perf_counters( std::string const &json_doc, ParseFlags policy ) {
+		auto counters = daw::json::benchmark::perf_counters( );
+		if( not counters.is_available( ) ) {
+			return std::nullopt;
+		}
+		auto counter_totals = daw::json::benchmark::perf_counter_values( );
+		for( std::size_t n = 0; n < DAW_NUM_RUNS; ++n ) {
+			counters.start( );
+			auto parse_result = Dataset::parse( json_doc, policy );
+			counter_totals += counters.stop( );
+			daw::do_not_optimize( parse_result );
+		}
+		auto const per_run = []( std::uint64_t total ) {
+			return static_cast<double>( total ) /
+			       static_cast<double>( DAW_NUM_RUNS );
+		};
+		return daw::bench::perf_counter_result{
+		  per_run( counter_totals.cycles ), per_run( counter_totals.instructions ),
+		  per_run( counter_totals.branch_misses ),
+		  per_run( counter_totals.l1d_misses ),
+		  per_run( counter_totals.llc_misses ) };
+	}
+
+	template<typename Dataset, ExecModeTypes ExecMode, CheckedParseMode Checked,
+	         ZeroTerminatedString ZeroTerm, MinifiedDocument Minified>
+	daw::bench::bench_result bench_cell( std::string const &json_doc ) {
+		constexpr auto policy = parse_flags<ExecMode, Checked, ZeroTerm, Minified>;
+
+		auto name = std::string( Dataset::file_name );
+		name += " from_json(exec=";
+		name += std::string_view( to_string( ExecMode ).data( ),
+		                          to_string( ExecMode ).size( ) );
+		name += ",checked=";
+		name += to_string( Checked );
+		name += ",zero_terminated=";
+		name += to_string( ZeroTerm );
+		name += ",minified=";
+		name += to_string( Minified );
+		name += ",allocator=";
+		name += allocator_name;
+		name += ')';
+
+		auto result = daw::bench::make_bench_result(
+		  std::move( name ), json_doc.size( ),
+		  daw::bench_n_test_json<DAW_NUM_RUNS>(
+		    [policy]( std::string const &jd ) {
+			    return Dataset::parse( jd, policy );
+		    },
+		    json_doc ),
+		  "daw_json_bench" );
+		result.perf_counters =
+		  measure_perf_counters<Dataset>( json_doc, policy );
+		show_result( result );
+		return result;
+	}
+
+	template<typename Dataset>
+	void bench_dataset( std::string const &test_data_path,
+	                    std::vector<daw::bench::bench_result> &results ) {
+		auto const file_name =
+		  test_data_path + '/' + std::string( Dataset::file_name );
+		auto const json_doc = daw::read_file( file_name );
+		if( not json_doc or json_doc->size( ) < 2U ) {
+			std::cerr << "Skipping " << file_name << ", it could not be read\n";
+			return;
+		}
+		// std::string is always zero terminated, so both documents are valid
+		// for ZeroTerminatedString::yes
+		auto const json_doc_minified = minify( *json_doc );
+
+		for_each_value<ExecModeTypes::compile_time, ExecModeTypes::runtime,
+		               ExecModeTypes::simd>( [&]( auto exec_mode ) {
+			for_each_value<CheckedParseMode::yes, CheckedParseMode::no>(
+			  [&]( auto checked ) {
+				  for_each_value<ZeroTerminatedString::no, ZeroTerminatedString::yes>(
+				    [&]( auto zero_term ) {
+					    for_each_value<MinifiedDocument::no, MinifiedDocument::yes>(
+					      [&]( auto minified ) {
+						      constexpr auto is_minified =
+						        decltype( minified )::value == MinifiedDocument::yes;
+						      results.push_back(
+						        bench_cell<Dataset, decltype( exec_mode )::value,
+						                   decltype( checked )::value,
+						                   decltype( zero_term )::value,
+						                   decltype( minified )::value>(
+						          is_minified ? json_doc_minified : *json_doc ) );
+					      } );
+				    } );
+			  } );
+		} );
+	}
+} // namespace
+
+int main( int argc, char **argv )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	if( argc < 2 ) {
+		std::cerr << "Must supply the path to test_data and optionally a results "
+		             "file to append to\n";
+		exit( 1 );
+	}
+	auto const test_data_path = std::string( argv[1] );
+	auto results = std::vector<daw::bench::bench_result>{ };
+
+	for_each_dataset( [&]( auto dataset ) {
+		bench_dataset<decltype( dataset )>( test_data_path, results );
+	} );
+
+	if( argc < 3 ) {
+		std::cout << daw::json::to_json_array( results ) << '\n';
+		return EXIT_SUCCESS;
+	}
+	daw::bench::append_results( argv[2], results );
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,83 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Write a synthetic twitter document to stdout, e.g.
+//   daw_json_corpus_generator test_data/twitter.json statuses=1000
+//     text_length=256 escape_density=0.05 shuffle=0.5 unknown_depth=8 seed=2
+//
+
+#include "defines.h"
+
+#include "daw_json_corpus_generator.h"
+#include "twitter_test_json.h"
+
+#include <daw/daw_read_file.h>
+#include <daw/json/daw_from_json.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+int main( int argc, char **argv )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	if( argc < 2 ) {
+		std::cerr << "Must supply the path to a seed twitter.json followed by "
+		             "any of statuses=, text_length=, escape_density=, shuffle=, "
+		             "unknown_depth= and seed=\n";
+		exit( 1 );
+	}
+	auto const seed_json = daw::read_file( argv[1] );
+	test_assert( seed_json and seed_json->size( ) >= 2U,
+	             "Could not read the seed document" );
+	auto const seed_doc =
+	  daw::json::from_json<daw::twitter::twitter_object_t>( *seed_json );
+
+	auto opts = daw::json::benchmark::corpus_options{ };
+	for( int n = 2; n < argc; ++n ) {
+		auto const arg = std::string_view( argv[n] );
+		auto const eq = arg.find( '=' );
+		test_assert( eq != std::string_view::npos,
+		             "Options must be of the form name=value" );
+		auto const name = arg.substr( 0, eq );
+		auto const value = std::string( arg.substr( eq + 1 ) );
+		if( name == "statuses" ) {
+			opts.status_count = std::stoull( value );
+		} else if( name == "text_length" ) {
+			opts.text_length = std::stoull( value );
+		} else if( name == "escape_density" ) {
+			opts.escape_density = std::stod( value );
+		} else if( name == "shuffle" ) {
+			opts.shuffle_probability = std::stod( value );
+		} else if( name == "unknown_depth" ) {
+			opts.unknown_depth = std::stoull( value );
+		} else if( name == "seed" ) {
+			opts.seed = static_cast<std::uint32_t>( std::stoul( value ) );
+		} else {
+			std::cerr << "Unknown option " << name << '\n';
+			exit( 1 );
+		}
+	}
+	std::cout << daw::json::benchmark::generate_twitter_corpus( seed_doc, opts )
+	          << '\n';
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,102 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Compare parsing the canonical ISO 8601 timestamp layouts, which are parsed 8
+// characters at a time, with equivalent ones that need the general parser
+//
+
+#include <daw/json/daw_json_link.h>
+
+#include <daw/daw_benchmark.h>
+#include <daw/daw_ensure.h>
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <tuple>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 100;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+using timestamp_t =
+  std::chrono::time_point<std::chrono::system_clock, std::chrono::milliseconds>;
+
+struct Date {
+	timestamp_t timestamp;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Date> {
+		static constexpr char const timestamp[] = "timestamp";
+		using type = json_member_list<json_date<timestamp, timestamp_t>>;
+
+		static constexpr auto to_json_data( Date const &d ) {
+			return std::forward_as_tuple( d.timestamp );
+		}
+	};
+} // namespace daw::json
+
+/// @brief A JSON array of count Date's, each with the timestamp suffix
+std::string make_dates( std::size_t count, std::string_view suffix ) {
+	auto result = std::string( "[" );
+	for( std::size_t n = 0; n < count; ++n ) {
+		if( n != 0 ) {
+			result += ',';
+		}
+		result += R"({"timestamp":"2024-09-)";
+		result += static_cast<char>( '0' + ( n % 3 ) );
+		result += static_cast<char>( '1' + ( n % 9 ) );
+		result += "T01:14:54";
+		result += suffix;
+		result += R"("})";
+	}
+	result += ']';
+	return result;
+}
+
+/// @brief Compare the canonical timestamp layouts that are parsed 8 characters
+/// at a time with equivalent ones that need the general parser
+void bench_dates( ) {
+	constexpr std::size_t count = 10'000;
+	auto const canonical = make_dates( count, "Z" );
+	auto const canonical_ms = make_dates( count, ".123Z" );
+	auto const offset = make_dates( count, "+00:00" );
+	auto const offset_ms = make_dates( count, ".123+00:00" );
+
+	auto const bench = []( std::string_view title, std::string const &doc ) {
+		auto const result = daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+		  title, doc.size( ),
+		  []( std::string_view json_doc ) {
+			  return daw::json::from_json_array<Date>( json_doc );
+		  },
+		  std::string_view( doc ) );
+		daw_ensure( result and result->size( ) == count );
+		return *result;
+	};
+	auto const r0 = bench( "canonical YYYY-MM-DDTHH:MM:SSZ", canonical );
+	auto const r1 = bench( "general YYYY-MM-DDTHH:MM:SS+00:00", offset );
+	auto const r2 = bench( "canonical YYYY-MM-DDTHH:MM:SS.fffZ", canonical_ms );
+	auto const r3 = bench( "general YYYY-MM-DDTHH:MM:SS.fff+00:00", offset_ms );
+	for( std::size_t n = 0; n < count; ++n ) {
+		daw_ensure( r0[n].timestamp == r1[n].timestamp );
+		daw_ensure( r2[n].timestamp == r3[n].timestamp );
+		daw_ensure( r2[n].timestamp - r0[n].timestamp ==
+		            std::chrono::milliseconds( 123 ) );
+	}
+}
+
+int main( ) {
+	bench_dates( );
+}
@@ -0,0 +1,270 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Time each call of from_json, json_value member access and to_json on many
+// distinct 200-2000 byte messages and report the tail latencies.  With
+// --flush-cache the caches are evicted before every call to show the cold
+// behaviour.
+//
+
+#include "defines.h"
+
+#include "bench_result.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/json/daw_json_link.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 25;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+struct rpc_param {
+	std::string name;
+	double value;
+	bool enabled;
+};
+
+struct rpc_message {
+	std::string jsonrpc;
+	std::int64_t id;
+	std::string method;
+	std::vector<rpc_param> params;
+	std::string trace_id;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<rpc_param> {
+		static inline constexpr char const name[] = "name";
+		static inline constexpr char const value[] = "value";
+		static inline constexpr char const enabled[] = "enabled";
+		using type = json_member_list<json_string<name>, json_number<value>,
+		                              json_bool<enabled>>;
+
+		static inline auto to_json_data( rpc_param const &v ) {
+			return std::forward_as_tuple( v.name, v.value, v.enabled );
+		}
+	};
+
+	template<>
+	struct json_data_contract<rpc_message> {
+		static inline constexpr char const jsonrpc[] = "jsonrpc";
+		static inline constexpr char const id[] = "id";
+		static inline constexpr char const method[] = "method";
+		static inline constexpr char const params[] = "params";
+		static inline constexpr char const trace_id[] = "trace_id";
+		using type =
+		  json_member_list<json_string<jsonrpc>, json_number<id, std::int64_t>,
+		                   json_string<method>, json_array<params, rpc_param>,
+		                   json_string<trace_id>>;
+
+		static inline auto to_json_data( rpc_message const &v ) {
+			return std::forward_as_tuple( v.jsonrpc, v.id, v.method, v.params,
+			                              v.trace_id );
+		}
+	};
+} // namespace daw::json
+
+inline namespace {
+	constexpr std::size_t message_count = 2'000;
+	constexpr std::size_t min_message_size = 200;
+	constexpr std::size_t max_message_size = 2'000;
+	// Larger than the last level cache of the machines we benchmark on
+	constexpr std::size_t cache_flush_size = 64U * 1024U * 1024U;
+	// Every call is timed, but only this many of the samples are kept in the
+	// results file
+	constexpr std::size_t max_stored_run_times = 1'000;
+
+	/// Distinct messages, each serialized to between min_message_size and
+	/// max_message_size bytes
+	std::vector<std::string> make_messages( ) {
+		auto rng = std::mt19937( 1 );
+		auto target_size = std::uniform_int_distribution<std::size_t>(
+		  min_message_size, max_message_size );
+		auto number = std::uniform_real_distribution<double>( -1e6, 1e6 );
+		auto coin = std::bernoulli_distribution( 0.5 );
+		auto result = std::vector<std::string>( );
+		result.reserve( message_count );
+		for( std::size_t n = 0; n < message_count; ++n ) {
+			auto const size = target_size( rng );
+			auto msg = rpc_message{ "2.0",
+			                        static_cast<std::int64_t>( n ),
+			                        "service.method_" + std::to_string( n % 97 ),
+			                        { },
+			                        "trace-" + std::to_string( rng( ) ) };
+			auto json_doc = daw::json::to_json( msg );
+			while( json_doc.size( ) < size ) {
+				msg.params.push_back(
+				  rpc_param{ "param_" + std::to_string( msg.params.size( ) ),
+				             number( rng ), coin( rng ) } );
+				json_doc = daw::json::to_json( msg );
+			}
+			if( json_doc.size( ) > max_message_size ) {
+				msg.params.pop_back( );
+				json_doc = daw::json::to_json( msg );
+			}
+			result.push_back( std::move( json_doc ) );
+		}
+		return result;
+	}
+
+	/// Evict the caches by writing and then reading a large buffer
+	void flush_caches( ) {
+		static auto buffer = std::vector<unsigned char>( cache_flush_size );
+		constexpr std::size_t cache_line_size = 64;
+		for( std::size_t n = 0; n < buffer.size( ); n += cache_line_size ) {
+			++buffer[n];
+		}
+		unsigned sum = 0;
+		for( std::size_t n = 0; n < buffer.size( ); n += cache_line_size ) {
+			sum += buffer[n];
+		}
+		daw::do_not_optimize( sum );
+	}
+
+	/// The time of each call of func on each input, DAW_NUM_RUNS times
+	template<typename Inputs, typename Func>
+	std::vector<std::chrono::nanoseconds>
+	time_calls( Inputs const &inputs, bool flush_cache, Func func ) {
+		auto result = std::vector<std::chrono::nanoseconds>( );
+		result.reserve( inputs.size( ) * DAW_NUM_RUNS );
+		for( std::size_t run = 0; run < DAW_NUM_RUNS; ++run ) {
+			for( auto const &input : inputs ) {
+				if( flush_cache ) {
+					flush_caches( );
+				}
+				auto const start = std::chrono::steady_clock::now( );
+				auto r = func( input );
+				daw::do_not_optimize( r );
+				auto const stop = std::chrono::steady_clock::now( );
+				result.push_back( stop - start );
+			}
+		}
+		return result;
+	}
+
+	/// The percentiles and tail latencies of the per call times, keeping an
+	/// evenly spaced subsample of them as the run times
+	daw::bench::bench_result
+	make_latency_result( std::string name, std::size_t data_size,
+	                     std::vector<std::chrono::nanoseconds> call_times ) {
+		auto sorted = call_times;
+		std::sort( sorted.begin( ), sorted.end( ) );
+		auto const stride = std::max<std::size_t>(
+		  1U, call_times.size( ) / max_stored_run_times );
+		auto run_times = std::vector<std::chrono::nanoseconds>( );
+		run_times.reserve( call_times.size( ) / stride + 1U );
+		for( std::size_t n = 0; n < call_times.size( ); n += stride ) {
+			run_times.push_back( call_times[n] );
+		}
+
+		using daw::bench::percentile;
+		auto result =
+		  daw::bench::make_bench_result( std::move( name ), data_size,
+		                                 std::move( run_times ),
+		                                 "daw_json_latency_bench" );
+		result.duration_min = sorted.front( );
+		result.duration_max = sorted.back( );
+		result.duration_25th_percentile = percentile( sorted, 0.25 );
+		result.duration_50th_percentile = percentile( sorted, 0.50 );
+		result.duration_75th_percentile = percentile( sorted, 0.75 );
+		result.tail_latency = daw::bench::tail_latency_result{
+		  percentile( sorted, 0.50 ), percentile( sorted, 0.99 ),
+		  percentile( sorted, 0.999 ) };
+
+		std::cout << result.name << ": p50 " << result.tail_latency->p50.count( )
+		          << "ns p99 " << result.tail_latency->p99.count( )
+		          << "ns p99.9 " << result.tail_latency->p999.count( )
+		          << "ns max " << result.duration_max.count( ) << "ns\n";
+		return result;
+	}
+} // namespace
+
+int main( int argc, char **argv )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	bool flush_cache = false;
+	std::optional<std::string> results_file{ };
+	for( int n = 1; n < argc; ++n ) {
+		if( std::string_view( argv[n] ) == "--flush-cache" ) {
+			flush_cache = true;
+		} else {
+			results_file = argv[n];
+		}
+	}
+
+	auto const messages = make_messages( );
+	auto parsed = std::vector<rpc_message>( );
+	parsed.reserve( messages.size( ) );
+	std::size_t total_size = 0;
+	for( auto const &msg : messages ) {
+		parsed.push_back( daw::json::from_json<rpc_message>( msg ) );
+		total_size += msg.size( );
+	}
+	auto const mean_size = total_size / messages.size( );
+	auto const suffix =
+	  std::string( flush_cache ? "(cold cache)" : "(warm cache)" );
+
+	auto results = std::vector<daw::bench::bench_result>{ };
+	results.push_back( make_latency_result(
+	  "small messages from_json" + suffix, mean_size,
+	  time_calls( messages, flush_cache, []( std::string const &msg ) {
+		  return daw::json::from_json<rpc_message>( msg );
+	  } ) ) );
+	results.push_back( make_latency_result(
+	  "small messages json_value" + suffix, mean_size,
+	  time_calls( messages, flush_cache, []( std::string const &msg ) {
+		  auto const jv = daw::json::json_value( msg );
+		  return std::tuple{
+		    daw::json::as<std::int64_t>( jv["id"] ),
+		    daw::json::as<double>( jv["params[0].value"] ),
+		    daw::json::as<std::string_view>( jv["trace_id"] ) };
+	  } ) ) );
+	results.push_back( make_latency_result(
+	  "small messages to_json" + suffix, mean_size,
+	  time_calls( parsed, flush_cache, []( rpc_message const &msg ) {
+		  return daw::json::to_json( msg );
+	  } ) ) );
+
+	if( not results_file ) {
+		return EXIT_SUCCESS;
+	}
+	daw::bench::append_results( *results_file, results );
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,193 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Sweep the shape of generated twitter documents one parameter at a time and
+// plot the parse throughput of each, so that cliffs like shuffled members or
+// long escaped strings are visible.  Optionally the points are written as CSV.
+//
+
+#include "defines.h"
+
+#include "daw_json_corpus_generator.h"
+#include "twitter_test_json.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/daw_read_file.h>
+#include <daw/json/daw_from_json.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 25;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+inline namespace {
+	using daw::json::benchmark::corpus_options;
+
+	struct sweep_point {
+		double value;
+		std::size_t data_size;
+		double mb_per_second;
+	};
+
+	struct sweep {
+		std::string_view parameter;
+		std::vector<double> values;
+		void ( *apply )( corpus_options &, double );
+	};
+
+	// Every sweep starts from these options and changes one parameter
+	constexpr corpus_options baseline_options( ) {
+		auto opts = corpus_options{ };
+		opts.status_count = 500;
+		return opts;
+	}
+
+	std::vector<sweep> const &sweeps( ) {
+		static auto const result = std::vector<sweep>{
+		  { "statuses",
+		    { 10, 100, 1'000, 10'000 },
+		    []( corpus_options &opts, double v ) {
+			    opts.status_count = static_cast<std::size_t>( v );
+		    } },
+		  { "text_length",
+		    { 16, 64, 256, 1'024, 4'096 },
+		    []( corpus_options &opts, double v ) {
+			    opts.text_length = static_cast<std::size_t>( v );
+		    } },
+		  { "escape_density",
+		    { 0.0, 0.01, 0.05, 0.1, 0.25, 0.5 },
+		    []( corpus_options &opts, double v ) {
+			    opts.text_length = 256;
+			    opts.escape_density = v;
+		    } },
+		  { "shuffle",
+		    { 0.0, 0.1, 0.25, 0.5, 1.0 },
+		    []( corpus_options &opts, double v ) {
+			    opts.shuffle_probability = v;
+		    } },
+		  { "unknown_depth",
+		    { 0, 4, 16, 64, 256 },
+		    []( corpus_options &opts, double v ) {
+			    opts.unknown_depth = static_cast<std::size_t>( v );
+		    } } };
+		return result;
+	}
+
+	sweep_point measure( daw::twitter::twitter_object_t const &seed_doc,
+	                     corpus_options const &opts, double value ) {
+		auto const json_doc =
+		  daw::json::benchmark::generate_twitter_corpus( seed_doc, opts );
+		// Ensure the mutations kept the document parsable
+		auto const check =
+		  daw::json::from_json<daw::twitter::twitter_object_t>( json_doc );
+		test_assert( check.statuses.size( ) == opts.status_count,
+		             "Generated document has the wrong number of statuses" );
+
+		auto const run_times = daw::bench_n_test_json<DAW_NUM_RUNS>(
+		  []( std::string const &jd ) {
+			  return daw::json::from_json<daw::twitter::twitter_object_t>( jd );
+		  },
+		  json_doc );
+		auto const min_time = std::chrono::duration<double>(
+		                        *std::min_element( run_times.begin( ),
+		                                           run_times.end( ) ) )
+		                        .count( );
+		return { value, json_doc.size( ),
+		         static_cast<double>( json_doc.size( ) ) / 1'000'000.0 /
+		           min_time };
+	}
+
+	/// Draw the throughput of each point as a bar scaled to the fastest
+	void plot( std::string_view parameter,
+	           std::vector<sweep_point> const &points ) {
+		constexpr std::size_t plot_width = 50;
+		auto const fastest =
+		  std::max_element( points.begin( ), points.end( ),
+		                    []( auto const &lhs, auto const &rhs ) {
+			                    return lhs.mb_per_second < rhs.mb_per_second;
+		                    } )
+		    ->mb_per_second;
+		std::cout << parameter << '\n';
+		for( auto const &point : points ) {
+			auto const bar_length = static_cast<std::size_t>(
+			  point.mb_per_second / fastest * static_cast<double>( plot_width ) );
+			std::cout << std::setw( 10 ) << point.value << " |"
+			          << std::string( bar_length, '#' )
+			          << std::string( plot_width - bar_length, ' ' ) << "| "
+			          << std::fixed << std::setprecision( 1 )
+			          << point.mb_per_second << " MB/s\n"
+			          << std::defaultfloat;
+		}
+		std::cout << '\n';
+	}
+} // namespace
+
+int main( int argc, char **argv )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	if( argc < 2 ) {
+		std::cerr << "Must supply the path to a seed twitter.json and optionally "
+		             "a CSV file to write the points to\n";
+		exit( 1 );
+	}
+	auto const seed_json = daw::read_file( argv[1] );
+	test_assert( seed_json and seed_json->size( ) >= 2U,
+	             "Could not read the seed document" );
+	auto const seed_doc =
+	  daw::json::from_json<daw::twitter::twitter_object_t>( *seed_json );
+
+	auto csv = std::string( "parameter,value,data_size,mb_per_second\n" );
+	for( auto const &s : sweeps( ) ) {
+		auto points = std::vector<sweep_point>( );
+		for( double value : s.values ) {
+			auto opts = baseline_options( );
+			s.apply( opts, value );
+			points.push_back( measure( seed_doc, opts, value ) );
+			auto const &point = points.back( );
+			csv += std::string( s.parameter ) + ',' + std::to_string( point.value ) +
+			       ',' + std::to_string( point.data_size ) + ',' +
+			       std::to_string( point.mb_per_second ) + '\n';
+		}
+		plot( s.parameter, points );
+	}
+
+	if( argc >= 3 ) {
+		auto out_file = std::ofstream( argv[2], std::ios::out | std::ios::trunc );
+		test_assert( out_file, "Could not open the CSV file" );
+		out_file.write( csv.data( ), static_cast<std::streamsize>( csv.size( ) ) );
+	}
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
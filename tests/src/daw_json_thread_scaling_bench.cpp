@@ -0,0 +1,196 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Parse and serialize each dataset in test_data on 1, 2, 4... threads at once
+// and report how the per thread throughput holds up.  Independent documents
+// should scale linearly, so a drop in efficiency points at shared state in
+// the parser or serializer, e.g. guarded function local statics.
+//
+
+#include "defines.h"
+
+#include "daw_json_bench_datasets.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/daw_read_file.h>
+#include <daw/json/daw_json_link.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 50;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+inline namespace {
+	using namespace daw::bench;
+
+	/// Run work( thread_index ) on thread_count threads that start together
+	/// @return The seconds each thread took
+	template<typename Work>
+	std::vector<double> run_on_threads( std::size_t thread_count, Work work ) {
+		auto seconds = std::vector<double>( thread_count );
+		auto ready = std::atomic<std::size_t>( 0 );
+		auto go = std::atomic<bool>( false );
+		auto threads = std::vector<std::thread>( );
+		threads.reserve( thread_count );
+		for( std::size_t n = 0; n < thread_count; ++n ) {
+			threads.emplace_back( [&, n] {
+				++ready;
+				while( not go.load( std::memory_order_acquire ) ) {
+					std::this_thread::yield( );
+				}
+				auto const start = std::chrono::steady_clock::now( );
+				work( n );
+				seconds[n] = std::chrono::duration<double>(
+				               std::chrono::steady_clock::now( ) - start )
+				               .count( );
+			} );
+		}
+		while( ready.load( ) != thread_count ) {
+			std::this_thread::yield( );
+		}
+		go.store( true, std::memory_order_release );
+		for( auto &t : threads ) {
+			t.join( );
+		}
+		return seconds;
+	}
+
+	std::vector<std::size_t> thread_counts( std::size_t max_threads ) {
+		auto result = std::vector<std::size_t>( );
+		for( std::size_t n = 1; n < max_threads; n *= 2 ) {
+			result.push_back( n );
+		}
+		result.push_back( max_threads );
+		return result;
+	}
+
+	/// Print the mean per thread throughput, the total and the efficiency
+	/// relative to the single thread run
+	void show_scaling( std::string_view name, std::size_t thread_count,
+	                   std::size_t bytes_per_thread,
+	                   std::vector<double> const &seconds,
+	                   double &single_thread_mbs ) {
+		auto const mbs_per_thread = [&] {
+			double total = 0.0;
+			for( double s : seconds ) {
+				total += static_cast<double>( bytes_per_thread ) / 1'000'000.0 / s;
+			}
+			return total / static_cast<double>( seconds.size( ) );
+		}( );
+		if( thread_count == 1 ) {
+			single_thread_mbs = mbs_per_thread;
+		}
+		std::cout << std::fixed << std::setprecision( 1 ) << name << " threads "
+		          << std::setw( 3 ) << thread_count << ": " << std::setw( 8 )
+		          << mbs_per_thread << " MB/s/thread " << std::setw( 9 )
+		          << ( mbs_per_thread * static_cast<double>( thread_count ) )
+		          << " MB/s total, efficiency " << std::setw( 5 )
+		          << ( 100.0 * mbs_per_thread / single_thread_mbs ) << "%\n";
+	}
+
+	template<typename Dataset>
+	void scale_dataset( std::string const &test_data_path,
+	                    std::size_t max_threads ) {
+		auto const file_name =
+		  test_data_path + '/' + std::string( Dataset::file_name );
+		auto const json_doc = daw::read_file( file_name );
+		if( not json_doc or json_doc->size( ) < 2U ) {
+			std::cerr << "Skipping " << file_name << ", it could not be read\n";
+			return;
+		}
+		constexpr auto policy = daw::json::options::parse_flags<>;
+		auto const bytes_per_thread = json_doc->size( ) * DAW_NUM_RUNS;
+		double parse_single_mbs = 0.0;
+		double serialize_single_mbs = 0.0;
+
+		for( std::size_t thread_count : thread_counts( max_threads ) ) {
+			// Each thread gets its own copy, like independent requests would
+			auto docs = std::vector<std::string>( thread_count, *json_doc );
+			auto parsed =
+			  std::vector<decltype( Dataset::parse( *json_doc, policy ) )>( );
+			parsed.reserve( thread_count );
+			for( auto const &doc : docs ) {
+				parsed.push_back( Dataset::parse( doc, policy ) );
+			}
+
+			auto const parse_seconds =
+			  run_on_threads( thread_count, [&]( std::size_t n ) {
+				  for( std::size_t run = 0; run < DAW_NUM_RUNS; ++run ) {
+					  auto result = Dataset::parse( docs[n], policy );
+					  daw::do_not_optimize( result );
+				  }
+			  } );
+			show_scaling( std::string( Dataset::file_name ) + " from_json",
+			              thread_count, bytes_per_thread, parse_seconds,
+			              parse_single_mbs );
+
+			auto const serialize_seconds =
+			  run_on_threads( thread_count, [&]( std::size_t n ) {
+				  for( std::size_t run = 0; run < DAW_NUM_RUNS; ++run ) {
+					  auto result = daw::json::to_json( parsed[n] );
+					  daw::do_not_optimize( result );
+				  }
+			  } );
+			show_scaling( std::string( Dataset::file_name ) + " to_json",
+			              thread_count, bytes_per_thread, serialize_seconds,
+			              serialize_single_mbs );
+		}
+		std::cout << '\n';
+	}
+} // namespace
+
+int main( int argc, char **argv )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	if( argc < 2 ) {
+		std::cerr << "Must supply the path to test_data and optionally the "
+		             "maximum number of threads\n";
+		exit( 1 );
+	}
+	auto const test_data_path = std::string( argv[1] );
+	auto const max_threads = [&]( ) -> std::size_t {
+		if( argc >= 3 ) {
+			return std::max<std::size_t>( 1U, std::stoull( argv[2] ) );
+		}
+		return std::max( 1U, std::thread::hardware_concurrency( ) );
+	}( );
+
+	for_each_dataset( [&]( auto dataset ) {
+		scale_dataset<decltype( dataset )>( test_data_path, max_threads );
+	} );
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
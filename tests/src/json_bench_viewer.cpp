@@ -12,8 +12,12 @@
 #include <daw/daw_memory_mapped_file.h>
 #include <daw/json/daw_json_link.h>
 
+#include <algorithm>
 #include <cassert>
+#include <chrono>
+#include <cmath>
 #include <cstdlib>
+#include <iomanip>
 #include <iostream>
 #include <map>
 #include <string>
@@ -96,17 +100,42 @@ static void show_result( daw::bench::bench_result const &result ) {
 	          << '\n';
 	std::cout << "max duration:             " << result.duration_max << '\n';
 	std::cout << "build type:               " << result.build_type << '\n';
+	if( auto const &counters = result.perf_counters; counters ) {
+		std::cout << "cycles/run:               " << counters->cycles << '\n';
+		std::cout << "instructions/run:         " << counters->instructions
+		          << '\n';
+		if( counters->cycles > 0.0 ) {
+			std::cout << "IPC:                      "
+			          << ( counters->instructions / counters->cycles ) << '\n';
+			std::cout << "bytes/cycle:              "
+			          << ( static_cast<double>( result.data_size ) /
+			               counters->cycles )
+			          << '\n';
+		}
+		std::cout << "branch misses/run:        " << counters->branch_misses
+		          << '\n';
+		std::cout << "L1d misses/run:           " << counters->l1d_misses
+		          << '\n';
+		std::cout << "LLC misses/run:           " << counters->llc_misses
+		          << '\n';
+	}
+	if( auto const &latency = result.tail_latency; latency ) {
+		std::cout << "p50 latency:              " << latency->p50 << '\n';
+		std::cout << "p99 latency:              " << latency->p99 << '\n';
+		std::cout << "p99.9 latency:            " << latency->p999 << '\n';
+	}
 }
 
-int main( int argc, char **argv ) {
-	if( argc < 2 ) {
-		std::cerr << "Must supply benchmark result file\n";
-		std::exit( EXIT_FAILURE );
-	}
-	auto in_file = daw::filesystem::memory_mapped_file_t<char>( argv[1] );
+static std::vector<daw::bench::bench_result>
+load_results( char const *file_name ) {
+	auto in_file = daw::filesystem::memory_mapped_file_t<char>( file_name );
 	assert( in_file.size( ) > 2 );
-	using namespace daw::json;
-	auto results = from_json<std::vector<daw::bench::bench_result>>( in_file );
+	return daw::json::from_json<std::vector<daw::bench::bench_result>>(
+	  in_file );
+}
+
+static void show_top_results( char const *file_name ) {
+	auto const results = load_results( file_name );
 
 	std::map<std::string_view, daw::bench::bench_result> min_results{ };
 	for( auto const &result : results ) {
@@ -125,3 +154,204 @@ int main( int argc, char **argv ) {
 		std::cout << "\n\n";
 	}
 }
+
+// A difference in the run times is significant when the Mann-Whitney z score
+// is beyond this, a two sided 95% confidence
+static constexpr double significant_z_score = 1.96;
+
+/***
+ * The z score of the Mann-Whitney U test of the candidate run times against
+ * the baseline.  It compares ranks, not values, so outlier runs do not skew
+ * it. A positive score means the candidate is slower.
+ */
+static double
+mann_whitney_z( std::vector<std::chrono::nanoseconds> const &baseline,
+                std::vector<std::chrono::nanoseconds> const &candidate ) {
+	if( baseline.empty( ) or candidate.empty( ) ) {
+		return 0.0;
+	}
+	struct sample_t {
+		std::chrono::nanoseconds value;
+		bool is_candidate;
+	};
+	auto samples = std::vector<sample_t>( );
+	samples.reserve( baseline.size( ) + candidate.size( ) );
+	for( auto v : baseline ) {
+		samples.push_back( { v, false } );
+	}
+	for( auto v : candidate ) {
+		samples.push_back( { v, true } );
+	}
+	std::sort( samples.begin( ), samples.end( ),
+	           []( sample_t const &lhs, sample_t const &rhs ) {
+		           return lhs.value < rhs.value;
+	           } );
+
+	auto const n = static_cast<double>( samples.size( ) );
+	double candidate_rank_sum = 0.0;
+	double tie_correction = 0.0;
+	std::size_t first = 0;
+	while( first < samples.size( ) ) {
+		auto last = first + 1;
+		while( last < samples.size( ) and
+		       samples[last].value == samples[first].value ) {
+			++last;
+		}
+		// Tied samples share the average of their ranks
+		auto const rank = static_cast<double>( first + 1 + last ) / 2.0;
+		auto const ties = static_cast<double>( last - first );
+		tie_correction += ties * ties * ties - ties;
+		for( auto idx = first; idx < last; ++idx ) {
+			if( samples[idx].is_candidate ) {
+				candidate_rank_sum += rank;
+			}
+		}
+		first = last;
+	}
+	auto const n1 = static_cast<double>( candidate.size( ) );
+	auto const n2 = static_cast<double>( baseline.size( ) );
+	auto const u = candidate_rank_sum - ( n1 * ( n1 + 1.0 ) ) / 2.0;
+	auto const mean = ( n1 * n2 ) / 2.0;
+	auto const variance =
+	  ( n1 * n2 / 12.0 ) * ( ( n + 1.0 ) - tie_correction / ( n * ( n - 1.0 ) ) );
+	if( variance <= 0.0 ) {
+		return 0.0;
+	}
+	return ( u - mean ) / std::sqrt( variance );
+}
+
+static double percent_delta( double baseline, double candidate ) {
+	if( baseline == 0.0 ) {
+		return 0.0;
+	}
+	return 100.0 * ( candidate - baseline ) / baseline;
+}
+
+static double percent_delta( std::chrono::nanoseconds baseline,
+                             std::chrono::nanoseconds candidate ) {
+	return percent_delta( static_cast<double>( baseline.count( ) ),
+	                      static_cast<double>( candidate.count( ) ) );
+}
+
+// The most recent result of each test name
+static std::map<std::string, daw::bench::bench_result>
+latest_results( char const *file_name ) {
+	auto results = std::map<std::string, daw::bench::bench_result>{ };
+	for( auto &result : load_results( file_name ) ) {
+		auto pos = results.find( result.name );
+		if( pos == results.end( ) ) {
+			auto name = result.name;
+			results.emplace( std::move( name ), std::move( result ) );
+		} else if( result.test_time >= pos->second.test_time ) {
+			pos->second = std::move( result );
+		}
+	}
+	return results;
+}
+
+/***
+ * Compare the candidate results to the baseline by test name.  A test has
+ * regressed when its median duration is more than threshold percent slower
+ * and the Mann-Whitney test says the difference is not noise.
+ * @return the number of regressed tests
+ */
+static std::size_t compare_results( char const *baseline_file,
+                                    char const *candidate_file,
+                                    double threshold ) {
+	auto const baseline = latest_results( baseline_file );
+	auto const candidate = latest_results( candidate_file );
+
+	auto const ae = daw::on_scope_exit(
+	  [old_flags = std::ios_base::fmtflags( std::cout.flags( ) )] {
+		  std::cout.flags( old_flags );
+	  } );
+	std::cout << std::setprecision( 2 ) << std::fixed << std::showpos;
+
+	std::size_t regressions = 0;
+	for( auto const &[name, cand] : candidate ) {
+		auto pos = baseline.find( name );
+		if( pos == baseline.end( ) ) {
+			std::cout << "new:        " << name << '\n';
+			continue;
+		}
+		auto const &base = pos->second;
+		auto const median_delta = percent_delta(
+		  base.duration_50th_percentile, cand.duration_50th_percentile );
+		auto const z = mann_whitney_z( base.run_times, cand.run_times );
+		// Without run times to test, rely on the threshold alone
+		bool const is_significant =
+		  base.run_times.empty( ) or cand.run_times.empty( ) or
+		  std::abs( z ) > significant_z_score;
+
+		if( is_significant and median_delta > threshold ) {
+			++regressions;
+			std::cout << "REGRESSED:  ";
+		} else if( is_significant and median_delta < -threshold ) {
+			std::cout << "improved:   ";
+		} else {
+			std::cout << "unchanged:  ";
+		}
+		std::cout << name << "\n            25th "
+		          << percent_delta( base.duration_25th_percentile,
+		                            cand.duration_25th_percentile )
+		          << "% 50th " << median_delta << "% 75th "
+		          << percent_delta( base.duration_75th_percentile,
+		                            cand.duration_75th_percentile )
+		          << "% z " << z << '\n';
+		if( base.perf_counters and cand.perf_counters and
+		    base.perf_counters->cycles > 0.0 and
+		    cand.perf_counters->cycles > 0.0 ) {
+			std::cout << "            IPC "
+			          << percent_delta( base.perf_counters->instructions /
+			                              base.perf_counters->cycles,
+			                            cand.perf_counters->instructions /
+			                              cand.perf_counters->cycles )
+			          << "% branch misses "
+			          << percent_delta( base.perf_counters->branch_misses,
+			                            cand.perf_counters->branch_misses )
+			          << "%\n";
+		}
+		if( base.tail_latency and cand.tail_latency ) {
+			std::cout << "            p99 "
+			          << percent_delta( base.tail_latency->p99,
+			                            cand.tail_latency->p99 )
+			          << "% p99.9 "
+			          << percent_delta( base.tail_latency->p999,
+			                            cand.tail_latency->p999 )
+			          << "%\n";
+		}
+	}
+	for( auto const &result : baseline ) {
+		if( candidate.count( result.first ) == 0 ) {
+			std::cout << "missing:    " << result.first << '\n';
+		}
+	}
+	std::cout << std::noshowpos << '\n'
+	          << regressions << " regression(s) above " << threshold << "%\n";
+	return regressions;
+}
+
+int main( int argc, char **argv ) {
+	if( argc < 2 ) {
+		std::cerr << "Must supply benchmark result file\n";
+		std::cerr << "Usage: " << argv[0] << " results.json\n";
+		std::cerr << "       " << argv[0]
+		          << " baseline.json candidate.json [threshold_percent]\n";
+		std::exit( EXIT_FAILURE );
+	}
+	if( argc < 3 ) {
+		show_top_results( argv[1] );
+		return EXIT_SUCCESS;
+	}
+	double threshold = 5.0;
+	if( argc > 3 ) {
+		threshold = std::strtod( argv[3], nullptr );
+		if( not( threshold >= 0.0 ) ) {
+			std::cerr << "Threshold must be a non-negative percentage\n";
+			std::exit( EXIT_FAILURE );
+		}
+	}
+	if( compare_results( argv[1], argv[2], threshold ) > 0 ) {
+		return EXIT_FAILURE;
+	}
+}
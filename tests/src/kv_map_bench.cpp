@@ -0,0 +1,125 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  Benchmark the key/value map targets of json_key_value on a large generated
+//  object.  The default std::unordered_map and std::vector constructors are
+//  sized from a count of the members before they are filled
+//
+
+#include "defines.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/json/daw_json_link.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 100;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+using hash_map_t = std::unordered_map<std::string, int>;
+using tree_map_t = std::map<std::string, int>;
+using flat_map_t = std::vector<std::pair<std::string, int>>;
+
+/// @brief Only constructs from the iterators, so the map grows as it is filled
+struct unsized_hash_map_constructor {
+	template<typename Iterator>
+	hash_map_t operator( )( Iterator first, Iterator last ) const {
+		return hash_map_t( first, last );
+	}
+};
+
+namespace daw::json {
+	template<typename Container, typename Constructor = use_default>
+	using kv_bench_member = json_key_value_no_name<Container, int, use_default,
+	                                               Constructor>;
+} // namespace daw::json
+
+template<typename JsonMember>
+void bench( std::string_view title, std::string_view json_doc,
+            std::size_t member_count ) {
+	auto const result = daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  title, json_doc.size( ),
+	  []( std::string_view sv ) {
+		  return daw::json::from_json<JsonMember>( sv );
+	  },
+	  json_doc );
+	test_assert( result, "Missing value" );
+	test_assert( result->size( ) == member_count, "Unexpected size" );
+}
+
+int main( int argc, char **argv )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	using namespace daw::json;
+	std::size_t const member_count = [&]( ) -> std::size_t {
+		if( argc > 1 ) {
+			return static_cast<std::size_t>( std::atoll( argv[1] ) );
+		}
+		return 100'000U;
+	}( );
+
+	auto json_doc = std::string( "{" );
+	for( std::size_t n = 0; n < member_count; ++n ) {
+		if( n > 0 ) {
+			json_doc += ',';
+		}
+		json_doc += "\"key_";
+		json_doc += std::to_string( ( n * 7919U ) % member_count );
+		json_doc += "\":";
+		json_doc += std::to_string( n );
+	}
+	json_doc += '}';
+	std::cout << "Parsing an object with " << member_count << " members, "
+	          << daw::utility::to_bytes_per_second( json_doc.size( ) ) << '\n';
+
+	bench<kv_bench_member<hash_map_t, unsized_hash_map_constructor>>(
+	  "std::unordered_map(unsized)", json_doc, member_count );
+	bench<kv_bench_member<hash_map_t>>( "std::unordered_map(presized)",
+	                                    json_doc, member_count );
+	bench<kv_bench_member<tree_map_t>>( "std::map", json_doc, member_count );
+	bench<kv_bench_member<flat_map_t>>( "std::vector<std::pair>", json_doc,
+	                                    member_count );
+	bench<kv_bench_member<flat_map_t, sorted_key_value_constructor<flat_map_t>>>(
+	  "std::vector<std::pair>(sorted)", json_doc, member_count );
+
+	auto const flat_map =
+	  from_json<kv_bench_member<flat_map_t,
+	                            sorted_key_value_constructor<flat_map_t>>>(
+	    json_doc );
+	test_assert( std::is_sorted( flat_map.begin( ), flat_map.end( ) ),
+	             "Expected sorted keys" );
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
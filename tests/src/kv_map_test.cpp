@@ -16,14 +16,21 @@
 #include <daw/daw_fnv1a_hash.h>
 #include <daw/daw_string_view.h>
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <string>
+#include <utility>
+#include <vector>
 
 struct kv_t {
 	std::unordered_map<std::string, int> kv{ };
 };
 
+struct kv3_t {
+	std::vector<std::pair<std::string, int>> kv{ };
+};
+
 struct kv2_t {
 	daw::bounded_hash_map<daw::string_view, int, 5, daw::fnv1a_hash_t> kv{ };
 };
@@ -52,6 +59,21 @@ namespace daw::json {
 		using type = json_member_list<json_key_value<
 		  kv, daw::bounded_hash_map<daw::string_view, int, 5, daw::fnv1a_hash_t>,
 		  int, daw::string_view>>;
+#endif
+	};
+
+	template<>
+	struct json_data_contract<kv3_t> {
+		using container_t = std::vector<std::pair<std::string, int>>;
+#if defined( DAW_JSON_CNTTP_JSON_NAME )
+		using type = json_member_list<
+		  json_key_value<"kv", container_t, int, use_default,
+		                 sorted_key_value_constructor<container_t>>>;
+#else
+		constexpr inline static char const kv[] = "kv";
+		using type = json_member_list<
+		  json_key_value<kv, container_t, int, use_default,
+		                 sorted_key_value_constructor<container_t>>>;
 #endif
 	};
 } // namespace daw::json
@@ -69,6 +91,28 @@ int main( int, char ** )
 	}})";
 	kv_t kv_test = daw::json::from_json<kv_t>( json_data3 );
 	daw::do_not_optimize( kv_test );
+	test_assert( kv_test.kv.size( ) == 3, "Unexpected size" );
+	// The members are counted before the map is filled
+	test_assert( kv_test.kv.bucket_count( ) >= 3, "Expected presized map" );
+	test_assert( kv_test.kv["key1"] == 1, "Unexpected value" );
+
+	{
+		// A flat map sorted by key once it is parsed
+		kv3_t kv3_test = daw::json::from_json<kv3_t>(
+		  std::string_view( R"({"kv":{"c":3,"a":1,"b":2}})" ) );
+		test_assert( kv3_test.kv.size( ) == 3, "Unexpected size" );
+		test_assert( kv3_test.kv.capacity( ) == 3, "Expected presized vector" );
+		test_assert( std::is_sorted( kv3_test.kv.begin( ), kv3_test.kv.end( ) ),
+		             "Expected sorted keys" );
+		test_assert( kv3_test.kv[0].first == "a" and kv3_test.kv[0].second == 1,
+		             "Unexpected value" );
+		test_assert( kv3_test.kv[2].first == "c" and kv3_test.kv[2].second == 3,
+		             "Unexpected value" );
+
+		kv3_t const empty_test =
+		  daw::json::from_json<kv3_t>( std::string_view( R"({"kv":{}})" ) );
+		test_assert( empty_test.kv.empty( ), "Unexpected size" );
+	}
 
 	DAW_CONSTEXPR
 	kv2_t kv2_test = daw::json::from_json<kv2_t>( json_data3 );
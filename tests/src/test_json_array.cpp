@@ -10,7 +10,9 @@
 
 #include <daw/daw_ensure.h>
 
+#include <algorithm>
 #include <optional>
+#include <string>
 #include <vector>
 
 struct Array {
@@ -91,4 +93,43 @@ int main( ) {
 		auto na21 = daw::json::from_json<NullableArray2>( R"json({})json" );
 		daw_ensure( na21.v.empty( ) );
 	}
+
+	{
+		auto const d0 = std::vector<double>{ 1.5, -0.25, 0.0, 1e300, 3.14159 };
+		auto const str = daw::json::to_json( d0 );
+		daw_ensure( str == "[1.5,-0.25,0,1e300,3.14159]" );
+		daw_ensure( daw::json::from_json<std::vector<double>>( str ) == d0 );
+	}
+
+	{
+		// float elements must not be widened to double when serialized
+		auto const f0 = std::vector<float>{ 0.1f, 2.5f, -1e-7f };
+		auto const str = daw::json::to_json( f0 );
+		daw_ensure( str == "[0.1,2.5,-1e-7]" );
+		daw_ensure( daw::json::from_json<std::vector<float>>( str ) == f0 );
+	}
+
+	{
+		daw_ensure( daw::json::to_json( std::vector<double>{ } ) == "[]" );
+	}
+
+	{
+		// Larger than the internal formatting buffer
+		auto d1 = std::vector<double>( 2000 );
+		for( std::size_t n = 0; n < d1.size( ); ++n ) {
+			d1[n] = static_cast<double>( n ) / 7.0;
+		}
+		auto const str = daw::json::to_json( d1 );
+		// The pretty printer formats each element separately
+		auto pretty = daw::json::to_json(
+		  d1, daw::json::options::output_flags<
+		        daw::json::options::SerializationFormat::Pretty> );
+		pretty.erase( std::remove_if( pretty.begin( ), pretty.end( ),
+		                              []( char c ) {
+			                              return c == ' ' or c == '\n' or
+			                                     c == '\t';
+		                              } ),
+		              pretty.end( ) );
+		daw_ensure( str == pretty );
+	}
 }
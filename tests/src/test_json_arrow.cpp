@@ -0,0 +1,165 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include <daw/json/daw_json_arrow.h>
+#include <daw/json/daw_json_link.h>
+
+#include <daw/daw_ensure.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct Reading {
+	std::string sensor;
+	double value;
+	std::optional<int> quality;
+	bool valid;
+};
+
+struct Tagged {
+	int id;
+	std::optional<std::string> tag;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Tagged> {
+		static constexpr char const id[] = "id";
+		static constexpr char const tag[] = "tag";
+		using type = json_member_list<
+		  json_number<id, int>, json_string_null<tag, std::optional<std::string>>>;
+	};
+
+	template<>
+	struct json_data_contract<Reading> {
+		static constexpr char const sensor[] = "sensor";
+		static constexpr char const value[] = "value";
+		static constexpr char const quality[] = "quality";
+		static constexpr char const valid[] = "valid";
+		using type =
+		  json_member_list<json_string<sensor>, json_number<value>,
+		                   json_number_null<quality, std::optional<int>>,
+		                   json_bool<valid>>;
+	};
+} // namespace daw::json
+
+int main( ) {
+	using namespace daw::json;
+	constexpr std::string_view json_lines_doc =
+	  R"({"sensor":"a","value":1.5,"quality":3,"valid":true}
+{"valid":false,"value":2.5,"sensor":"bb"}
+{"sensor":"","value":-1,"quality":null,"valid":true}
+{"sensor":"dddd","value":4,"quality":9,"valid":false,"extra":{}}
+{"sensor":"e\"","value":5,"valid":true}
+)";
+	{
+		std::vector<std::size_t> batch_rows{ };
+		std::vector<std::string> sensors{ };
+		std::vector<double> values{ };
+		std::size_t null_count = 0;
+		std::vector<bool> valids{ };
+		std::vector<bool> has_quality{ };
+		auto const row_count = json_lines_to_arrow<Reading>(
+		  json_lines_doc, 2,
+		  [&]( arrow_columns_t<Reading> const &columns, std::size_t rows ) {
+			  batch_rows.push_back( rows );
+			  auto const &sensor = std::get<0>( columns );
+			  auto const &value = std::get<1>( columns );
+			  auto const &quality = std::get<2>( columns );
+			  auto const &valid = std::get<3>( columns );
+			  daw_ensure( sensor.size( ) == rows );
+			  daw_ensure( sensor.offsets( ).size( ) == rows + 1 );
+			  daw_ensure( sensor.offsets( ).front( ) == 0 );
+			  daw_ensure( static_cast<std::size_t>( sensor.offsets( ).back( ) ) ==
+			              sensor.data( ).size( ) );
+			  daw_ensure( value.values( ).size( ) == rows );
+			  daw_ensure( quality.validity( ).bytes( ).size( ) == ( rows + 7 ) / 8 );
+			  null_count += quality.null_count( );
+			  for( std::size_t n = 0; n < rows; ++n ) {
+				  sensors.emplace_back( sensor[n] );
+				  values.push_back( value.values( )[n] );
+				  has_quality.push_back( quality.validity( ).test( n ) );
+				  valids.push_back( valid.values( ).test( n ) );
+				  daw_ensure( valid.validity( ).test( n ) );
+			  }
+		  } );
+		daw_ensure( row_count == 5 );
+		daw_ensure( batch_rows == std::vector<std::size_t>{ 2, 2, 1 } );
+		daw_ensure( sensors ==
+		            std::vector<std::string>{ "a", "bb", "", "dddd", "e\"" } );
+		daw_ensure( values == std::vector<double>{ 1.5, 2.5, -1.0, 4.0, 5.0 } );
+		daw_ensure( has_quality ==
+		            std::vector<bool>{ true, false, false, true, false } );
+		daw_ensure( null_count == 3 );
+		daw_ensure( valids == std::vector<bool>{ true, false, true, false, true } );
+	}
+	{
+		// The batch builder driven directly by a json_lines_iterator
+		auto builder = json_arrow_batch_builder<Reading>( 16 );
+		auto first = json_lines_iterator<Reading>( json_lines_doc );
+		auto const last = json_lines_iterator<Reading>( );
+		daw_ensure( not builder.fill( first, last ) );
+		daw_ensure( builder.size( ) == 5 );
+		auto const &quality = std::get<2>( builder.columns( ) );
+		daw_ensure( quality.values( )[0] == 3 );
+		daw_ensure( quality.values( )[1] == 0 );
+		daw_ensure( quality.values( )[3] == 9 );
+		daw_ensure( quality.validity( ).bytes( )[0] == 0b0000'1001U );
+		auto const &valid = std::get<3>( builder.columns( ) );
+		daw_ensure( valid.values( ).bytes( )[0] == 0b0001'0101U );
+		builder.flush( []( auto const &, std::size_t rows ) {
+			daw_ensure( rows == 5 );
+		} );
+		daw_ensure( builder.size( ) == 0 );
+		daw_ensure( std::get<0>( builder.columns( ) ).size( ) == 0 );
+		daw_ensure( std::get<0>( builder.columns( ) ).offsets( ).size( ) == 1 );
+	}
+#if defined( DAW_USE_EXCEPTIONS )
+	{
+		// Escapes are decoded into the arena and a row that fails after some of
+		// its columns were appended to is removed from all of them
+		constexpr std::string_view tagged_doc =
+		  R"({"id":1,"tag":"caf\u00e9 \ud83d\ude00"}
+{"id":2}
+{"id":3,"tag":"\ud83d"}
+{"id":4,"tag":"x"}
+)";
+		auto builder = json_arrow_batch_builder<Tagged>( 16 );
+		auto first = json_lines_iterator<Tagged>( tagged_doc );
+		builder.append( first );
+		++first;
+		builder.append( first );
+		++first;
+		bool has_error = false;
+		try {
+			builder.append( first );
+		} catch( json_exception const & ) {
+			has_error = true;
+		}
+		daw_ensure( has_error );
+		daw_ensure( builder.size( ) == 2 );
+		auto const &id = std::get<0>( builder.columns( ) );
+		auto const &tag = std::get<1>( builder.columns( ) );
+		daw_ensure( id.size( ) == 2 );
+		daw_ensure( tag.size( ) == 2 );
+		daw_ensure( tag.null_count( ) == 1 );
+		daw_ensure( tag[0] == "caf\xC3\xA9 \xF0\x9F\x98\x80" );
+		daw_ensure( static_cast<std::size_t>( tag.offsets( ).back( ) ) ==
+		            tag.data( ).size( ) );
+		++first;
+		builder.append( first );
+		daw_ensure( builder.size( ) == 3 );
+		daw_ensure( id.values( )[2] == 4 );
+		daw_ensure( tag[2] == "x" );
+	}
+#endif
+}
@@ -0,0 +1,131 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include <daw/json/daw_json_columns.h>
+#include <daw/json/daw_json_link.h>
+
+#include <daw/daw_ensure.h>
+
+#include <deque>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+struct Trade {
+	std::string symbol;
+	double price;
+	int qty;
+	std::optional<int> venue;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Trade> {
+		static constexpr char const symbol[] = "symbol";
+		static constexpr char const price[] = "price";
+		static constexpr char const qty[] = "qty";
+		static constexpr char const venue[] = "venue";
+		using type =
+		  json_member_list<json_string<symbol>, json_number<price>,
+		                   json_number<qty, int>,
+		                   json_number_null<venue, std::optional<int>>>;
+
+		static auto to_json_data( Trade const &v ) {
+			return std::forward_as_tuple( v.symbol, v.price, v.qty, v.venue );
+		}
+	};
+} // namespace daw::json
+
+int main( ) {
+	using namespace daw::json;
+	{
+		// Members in order, out of order, missing nullables and unknown members
+		constexpr std::string_view json_doc = R"([
+			{"symbol":"A","price":1.5,"qty":10,"venue":3},
+			{"qty":20,"price":2.5,"symbol":"B"},
+			{"symbol":"C","extra":[1,{"a":2}],"price":3.5,"qty":30}
+		])";
+		auto const [symbols, prices, qtys, venues] =
+		  from_json_columns<Trade>( json_doc );
+		daw_ensure( symbols == std::vector<std::string>{ "A", "B", "C" } );
+		daw_ensure( prices == std::vector<double>{ 1.5, 2.5, 3.5 } );
+		daw_ensure( qtys == std::vector<int>{ 10, 20, 30 } );
+		daw_ensure( venues.size( ) == 3 );
+		daw_ensure( venues[0] == 3 );
+		daw_ensure( not venues[1] );
+		daw_ensure( not venues[2] );
+	}
+	{
+		auto const columns = from_json_columns<Trade>( std::string_view( "[ ]" ) );
+		daw_ensure( std::get<0>( columns ).empty( ) );
+		daw_ensure( std::get<3>( columns ).empty( ) );
+	}
+	{
+		// User column types, appended to across documents
+		using columns_t =
+		  std::tuple<std::deque<std::string>, std::vector<double>,
+		             std::vector<long long>, std::vector<std::optional<int>>>;
+		auto columns = columns_t{ };
+		append_json_columns<Trade>(
+		  std::string_view( R"([{"symbol":"A","price":1,"qty":1}])" ), columns );
+		append_json_columns<Trade>(
+		  std::string_view( R"([{"symbol":"B","price":2,"qty":2}])" ), columns,
+		  options::parse_flags<options::CheckedParseMode::yes> );
+		daw_ensure( std::get<0>( columns ).size( ) == 2 );
+		daw_ensure( std::get<0>( columns )[1] == "B" );
+		daw_ensure( std::get<2>( columns )[1] == 2 );
+	}
+	{
+		// The columns match parsing the array of classes
+		auto const trades = std::vector<Trade>{ { "X", 9.25, 7, 1 },
+		                                        { "Y", -1.0, 0, std::nullopt } };
+		auto const json_doc = to_json_array( trades );
+		auto const [symbols, prices, qtys, venues] =
+		  from_json_columns<Trade>( json_doc );
+		auto const parsed = from_json_array<Trade>( json_doc );
+		daw_ensure( parsed.size( ) == symbols.size( ) );
+		for( std::size_t n = 0; n < parsed.size( ); ++n ) {
+			daw_ensure( parsed[n].symbol == symbols[n] );
+			daw_ensure( parsed[n].price == prices[n] );
+			daw_ensure( parsed[n].qty == qtys[n] );
+			daw_ensure( parsed[n].venue == venues[n] );
+		}
+	}
+#if defined( DAW_USE_EXCEPTIONS )
+	{
+		bool has_error = false;
+		try {
+			(void)from_json_columns<Trade>(
+			  std::string_view( R"({"symbol":"A"})" ) );
+		} catch( json_exception const & ) {
+			has_error = true;
+		}
+		daw_ensure( has_error );
+	}
+	{
+		// An element with an error appends none of its members
+		auto columns = json_columns_t<Trade>{ };
+		bool has_error = false;
+		try {
+			append_json_columns<Trade>(
+			  std::string_view(
+			    R"([{"symbol":"A","price":1,"qty":1},{"symbol":"B","price":2}])" ),
+			  columns );
+		} catch( json_exception const & ) {
+			has_error = true;
+		}
+		daw_ensure( has_error );
+		daw_ensure( std::get<0>( columns ).size( ) == 1 );
+		daw_ensure( std::get<1>( columns ).size( ) == 1 );
+		daw_ensure( std::get<2>( columns ).size( ) == 1 );
+		daw_ensure( std::get<3>( columns ).size( ) == 1 );
+	}
+#endif
+}
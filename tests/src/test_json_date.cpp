@@ -11,6 +11,8 @@
 #include <daw/daw_ensure.h>
 
 #include <chrono>
+#include <string>
+#include <string_view>
 #include <tuple>
 
 using timestamp_t =
@@ -62,8 +64,59 @@ static_assert( daw::json::from_json<NullableDate>(
                daw::json::datetime::civil_to_time_point( 2024, 9, 2, 1, 14, 54,
                                                          0 ) );
 
+static_assert( daw::json::from_json<Date>(
+                 R"json({"timestamp":"2024-09-02T01:14:54.123Z"})json" )
+                 .timestamp ==
+               daw::json::datetime::civil_to_time_point(
+                 2024, 9, 2, 1, 14, 54, 123'000'000 ) );
+
+timestamp_t parse_timestamp( std::string_view timestamp ) {
+	auto const json_doc =
+	  R"({"timestamp":")" + std::string( timestamp ) + R"("})";
+	return daw::json::from_json<Date>( json_doc ).timestamp;
+}
+
+#if defined( DAW_USE_EXCEPTIONS )
+/// @brief from_json<Date> of the timestamp throws InvalidTimestamp
+bool is_invalid_timestamp( std::string_view timestamp ) {
+	auto const json_doc =
+	  R"({"timestamp":")" + std::string( timestamp ) + R"("})";
+	try {
+		(void)daw::json::from_json<Date>( json_doc );
+	} catch( daw::json::json_exception const &jex ) {
+		return jex.reason_type( ) == daw::json::ErrorReason::InvalidTimestamp;
+	}
+	return false;
+}
+#endif
+
 int main( ) {
+	// Layouts close to the canonical ones go to the general parser
+	auto const expected_s =
+	  daw::json::datetime::civil_to_time_point( 2024, 9, 2, 1, 14, 54, 0 );
+	daw_ensure( parse_timestamp( "2024-09-02T01:14:54z" ) == expected_s );
+	daw_ensure( parse_timestamp( "2024-09-02T01:14:54+0000" ) == expected_s );
+	daw_ensure( parse_timestamp( "2024-09-02T01:14:54" ) == expected_s );
+	daw_ensure( parse_timestamp( "2024-09-02T01:14:54.1234Z" ) ==
+	            expected_s + std::chrono::milliseconds( 123 ) );
+	daw_ensure( parse_timestamp( "2024-09-02T01:14:54.5Z" ) ==
+	            expected_s + std::chrono::milliseconds( 500 ) );
+	daw_ensure( parse_timestamp( "2024-09-02T01:14:54.123z" ) ==
+	            expected_s + std::chrono::milliseconds( 123 ) );
+
 #if defined( DAW_USE_EXCEPTIONS )
+	// Out of range fields in the canonical layouts
+	daw_ensure( is_invalid_timestamp( "2024-13-02T01:14:54Z" ) );
+	daw_ensure( is_invalid_timestamp( "2024-00-02T01:14:54Z" ) );
+	daw_ensure( is_invalid_timestamp( "2024-09-32T01:14:54Z" ) );
+	daw_ensure( is_invalid_timestamp( "2024-09-02T25:14:54Z" ) );
+	daw_ensure( is_invalid_timestamp( "2024-09-02T01:60:54Z" ) );
+	daw_ensure( is_invalid_timestamp( "2024-09-02T01:14:61Z" ) );
+	daw_ensure( is_invalid_timestamp( "2024-13-02T01:14:54.123Z" ) );
+	daw_ensure( is_invalid_timestamp( "2024-09-02T25:14:54.123Z" ) );
+	// Neither canonical nor an offset
+	daw_ensure( is_invalid_timestamp( "2024-09-02T01:14:54Y" ) );
+
 	{
 		bool success = false;
 		try {
@@ -0,0 +1,77 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// The event parser must continue with the siblings after a nested class or
+// array
+//
+
+#include <daw/json/daw_json_event_parser.h>
+#include <daw/json/daw_json_link.h>
+
+#include <daw/daw_ensure.h>
+
+#include <string>
+#include <string_view>
+
+struct event_recorder {
+	std::string events;
+
+	template<typename JsonValue>
+	bool handle_on_class_start( JsonValue ) {
+		events += '{';
+		return true;
+	}
+
+	bool handle_on_class_end( ) {
+		events += '}';
+		return true;
+	}
+
+	template<typename JsonValue>
+	bool handle_on_array_start( JsonValue ) {
+		events += '[';
+		return true;
+	}
+
+	bool handle_on_array_end( ) {
+		events += ']';
+		return true;
+	}
+
+	bool handle_on_number( double d ) {
+		events += std::to_string( static_cast<int>( d ) );
+		return true;
+	}
+
+	template<typename JsonValue>
+	bool handle_on_string( JsonValue ) {
+		events += 's';
+		return true;
+	}
+};
+
+std::string events_of( std::string_view json_doc ) {
+	auto handler = event_recorder{ };
+	daw::json::json_event_parser( json_doc, handler );
+	return handler.events;
+}
+
+int main( ) {
+	daw_ensure( events_of( R"({"a":[1,{"b":[2,3]},4],"c":5})" ) ==
+	            "{[1{[23]}4]5}" );
+	daw_ensure( events_of( R"([ [ ] , { } , [ [ 1 ] ] , "x" , 2 ])" ) ==
+	            "[[]{}[[1]]s2]" );
+	daw_ensure( events_of( R"({"a":{},"b":[],"c":{"d":{"e":[6]}},"f":7})" ) ==
+	            "{{}[]{{[6]}}7}" );
+
+	auto deep = std::string( 1000, '[' );
+	deep += '8';
+	deep += std::string( 1000, ']' );
+	auto const deep_events = events_of( deep );
+	daw_ensure( deep_events.size( ) == 2001 );
+	daw_ensure( deep_events[1000] == '8' );
+}
@@ -0,0 +1,159 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include <daw/json/daw_json_link.h>
+
+#include <daw/daw_ensure.h>
+
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+struct Point {
+	int x;
+	int y;
+};
+
+struct Message {
+	std::string topic;
+	std::vector<Point> points;
+	std::map<std::string, std::vector<int>> tags;
+	std::optional<std::string> note;
+	double value;
+};
+
+// to_json_data returns values, it is parsed and assigned
+struct Total {
+	int value;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Point> {
+		static constexpr char const x[] = "x";
+		static constexpr char const y[] = "y";
+		using type = json_member_list<json_number<x, int>, json_number<y, int>>;
+
+		static auto to_json_data( Point const &v ) {
+			return std::forward_as_tuple( v.x, v.y );
+		}
+	};
+
+	template<>
+	struct json_data_contract<Message> {
+		static constexpr char const topic[] = "topic";
+		static constexpr char const points[] = "points";
+		static constexpr char const tags[] = "tags";
+		static constexpr char const note[] = "note";
+		static constexpr char const value[] = "value";
+		using type = json_member_list<
+		  json_string<topic>, json_array<points, Point>,
+		  json_key_value<tags, std::map<std::string, std::vector<int>>,
+		                 std::vector<int>>,
+		  json_string_null<note, std::optional<std::string>>,
+		  json_number<value>>;
+
+		static auto to_json_data( Message const &v ) {
+			return std::forward_as_tuple( v.topic, v.points, v.tags, v.note,
+			                              v.value );
+		}
+	};
+
+	template<>
+	struct json_data_contract<Total> {
+		static constexpr char const value[] = "value";
+		using type = json_member_list<json_number<value, int>>;
+
+		static auto to_json_data( Total const &v ) {
+			return std::tuple<int>( v.value );
+		}
+	};
+} // namespace daw::json
+
+int main( ) {
+	using namespace daw::json;
+	{
+		std::string_view const doc1 = R"({
+			"topic": "a topic that is longer than the small string buffer",
+			"points": [{"x":1,"y":2},{"x":3,"y":4},{"x":5,"y":6}],
+			"tags": {"first tag that is long enough":[1,2,3],"second":[4]},
+			"note": "n",
+			"value": 1.5
+		})";
+		// Out of order members, escapes, shorter array and a removed key
+		std::string_view const doc2 = R"({
+			"value": 2.5,
+			"tags": {"first tag that is long enough":[7]},
+			"points": [{"y":8,"x":7}],
+			"topic": "another topic longer than the small string buffer"
+		})";
+		auto msg = Message{ };
+		from_json_into( msg, doc1 );
+		daw_ensure( msg.topic ==
+		            "a topic that is longer than the small string buffer" );
+		daw_ensure( msg.points.size( ) == 3 );
+		daw_ensure( msg.points[2].x == 5 and msg.points[2].y == 6 );
+		daw_ensure( msg.tags.size( ) == 2 );
+		daw_ensure( msg.note == "n" );
+		daw_ensure( msg.value == 1.5 );
+
+		char const *const topic_data = msg.topic.data( );
+		Point const *const points_data = msg.points.data( );
+		std::vector<int> const *const first_tag =
+		  &msg.tags.at( "first tag that is long enough" );
+		int const *const first_tag_data = first_tag->data( );
+
+		from_json_into( msg, doc2 );
+		daw_ensure( msg.topic ==
+		            "another topic longer than the small string buffer" );
+		daw_ensure( msg.points.size( ) == 1 );
+		daw_ensure( msg.points[0].x == 7 and msg.points[0].y == 8 );
+		daw_ensure( msg.tags.size( ) == 1 );
+		daw_ensure( msg.tags.at( "first tag that is long enough" ) ==
+		            std::vector<int>{ 7 } );
+		daw_ensure( not msg.note );
+		daw_ensure( msg.value == 2.5 );
+		// The storage is reused
+		daw_ensure( msg.topic.data( ) == topic_data );
+		daw_ensure( msg.points.data( ) == points_data );
+		daw_ensure( &msg.tags.at( "first tag that is long enough" ) == first_tag );
+		daw_ensure( first_tag->data( ) == first_tag_data );
+
+		// A longer array appends
+		from_json_into( msg, doc1 );
+		daw_ensure( msg.points.size( ) == 3 );
+		daw_ensure( msg.points[0].x == 1 );
+		daw_ensure( msg.tags.size( ) == 2 );
+		daw_ensure( msg.tags.at( "second" ) == std::vector<int>{ 4 } );
+	}
+	{
+		auto values = std::unordered_map<std::string, int>{ { "a", 1 } };
+		from_json_into( values, std::string_view( R"({"b":2,"a":3})" ) );
+		daw_ensure( values.size( ) == 2 );
+		daw_ensure( values.at( "a" ) == 3 );
+		daw_ensure( values.at( "b" ) == 2 );
+
+		auto str = std::string( "previous value" );
+		from_json_into( str, std::string_view( R"("next")" ) );
+		daw_ensure( str == "next" );
+
+		auto total = Total{ 1 };
+		from_json_into( total, std::string_view( R"({"value":5})" ) );
+		daw_ensure( total.value == 5 );
+	}
+	{
+		auto ints = std::vector<int>{ 1, 2, 3 };
+		from_json_into<json_link_no_name<std::vector<int>>>(
+		  ints, std::string_view( "[4,5]" ),
+		  options::parse_flags<options::CheckedParseMode::yes> );
+		daw_ensure( ints == std::vector<int>{ 4, 5 } );
+	}
+}
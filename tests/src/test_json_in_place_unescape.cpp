@@ -0,0 +1,132 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include <daw/json/daw_json_link.h>
+
+#include <daw/daw_ensure.h>
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+struct Strings {
+	std::string_view a;
+	std::string_view b;
+	std::vector<std::string_view> c;
+	std::string d;
+};
+
+// The tag is read ahead of the variant, escaped strings in the class must
+// still be intact for the members parsed after it
+struct Tagged {
+	std::variant<int, std::string> body;
+	std::string_view name;
+};
+
+struct TaggedSwitcher {
+	std::size_t operator( )( std::string const &tag ) const {
+		return tag == "a\"b" ? 0 : 1;
+	}
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Strings> {
+		static constexpr char const a[] = "a";
+		static constexpr char const b[] = "b";
+		static constexpr char const c[] = "c";
+		static constexpr char const d[] = "d";
+		using type = json_member_list<
+		  json_string<a, std::string_view>, json_string<b, std::string_view>,
+		  json_array<c, json_string_no_name<std::string_view>,
+		             std::vector<std::string_view>>,
+		  json_string<d>>;
+
+		static auto to_json_data( Strings const &v ) {
+			return std::forward_as_tuple( v.a, v.b, v.c, v.d );
+		}
+	};
+
+	template<>
+	struct json_data_contract<Tagged> {
+		static constexpr char const body[] = "body";
+		static constexpr char const type_mem[] = "type";
+		static constexpr char const name[] = "name";
+		using type = json_member_list<
+		  json_tagged_variant<body, std::variant<int, std::string>,
+		                      json_string<type_mem>, TaggedSwitcher>,
+		  json_string<name, std::string_view>>;
+	};
+} // namespace daw::json
+
+template<daw::json::options::ExecModeTypes ExecMode>
+void test( ) {
+	using namespace daw::json;
+	auto doc = std::string(
+	  R"json({"a":"plain","b":"tab\there \"q\" \u00e9 \ud83d\ude00",)json"
+	  R"json("c":["x\\y","\/",""],)json"
+	  R"json("d":"\n0123456789abcdef0123456789\u00e9)json"
+	  R"json(\ud83d\ude000123456789abcdef"})json" );
+	auto const doc_first = doc.data( );
+	auto const doc_last = doc.data( ) + doc.size( );
+	auto const v = from_json<Strings>(
+	  doc, options::parse_flags<options::InPlaceUnescape::yes, ExecMode> );
+
+	daw_ensure( v.a == "plain" );
+	daw_ensure( v.b == "tab\there \"q\" \xc3\xa9 \xf0\x9f\x98\x80" );
+	daw_ensure( v.c.size( ) == 3 );
+	daw_ensure( v.c[0] == "x\\y" );
+	daw_ensure( v.c[1] == "/" );
+	daw_ensure( v.c[2].empty( ) );
+	daw_ensure( v.d == "\n0123456789abcdef0123456789\xc3\xa9\xf0\x9f\x98\x80"
+	                   "0123456789abcdef" );
+	// The views refer to the unescaped text inside the document
+	daw_ensure( v.b.data( ) > doc_first and v.b.data( ) < doc_last );
+	daw_ensure( v.c[0].data( ) > doc_first and v.c[0].data( ) < doc_last );
+
+	// An escape inside a block after the first must not be overwritten by the
+	// unescaped text being copied over it
+	auto doc2 = std::string( R"json("\n0123\tABCDEFGHIJKLMNOPQRSTUVWXYZ")json" );
+	auto const s = from_json<std::string_view>(
+	  doc2, options::parse_flags<options::InPlaceUnescape::yes, ExecMode> );
+	daw_ensure( s == "\n0123\tABCDEFGHIJKLMNOPQRSTUVWXYZ" );
+
+	// Escaped variant tags and the members around them
+	auto doc3 =
+	  std::string( R"json({"name":"x\"y","type":"a\"b","body":5})json" );
+	auto const t0 = from_json<Tagged>(
+	  doc3, options::parse_flags<options::InPlaceUnescape::yes, ExecMode> );
+	daw_ensure( std::get<int>( t0.body ) == 5 );
+	daw_ensure( t0.name == "x\"y" );
+
+	auto doc4 =
+	  std::string( R"json({"type":"c\\d","body":"x\ty","name":"n"})json" );
+	auto const t1 = from_json<Tagged>(
+	  doc4, options::parse_flags<options::InPlaceUnescape::yes, ExecMode> );
+	daw_ensure( std::get<std::string>( t1.body ) == "x\ty" );
+	daw_ensure( t1.name == "n" );
+
+	auto doc5 = std::string(
+	  R"json({"body":"\"q\"","name":"\u00e9","type":"\u0061b"})json" );
+	auto const t2 = from_json<Tagged>(
+	  doc5, options::parse_flags<options::InPlaceUnescape::yes, ExecMode> );
+	daw_ensure( std::get<std::string>( t2.body ) == "\"q\"" );
+	daw_ensure( t2.name == "\xc3\xa9" );
+}
+
+int main( ) {
+	test<daw::json::options::ExecModeTypes::compile_time>( );
+	test<daw::json::options::ExecModeTypes::runtime>( );
+	if constexpr( not std::is_same_v<daw::json::simd_exec_tag,
+	                                 daw::json::runtime_exec_tag> ) {
+		test<daw::json::options::ExecModeTypes::simd>( );
+	}
+}
@@ -0,0 +1,126 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_merge_patch.h>
+
+#include <daw/daw_ensure.h>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+struct Position {
+	double x;
+	double y;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Position> {
+		static constexpr char const x[] = "x";
+		static constexpr char const y[] = "y";
+		using type = json_member_list<json_number<x>, json_number<y>>;
+
+		static constexpr auto to_json_data( Position const &v ) {
+			return std::forward_as_tuple( v.x, v.y );
+		}
+	};
+} // namespace daw::json
+
+struct Player {
+	std::string name;
+	int score;
+	Position position;
+	std::optional<std::string> team;
+	std::vector<int> items;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Player> {
+		static constexpr char const name[] = "name";
+		static constexpr char const score[] = "score";
+		static constexpr char const position[] = "position";
+		static constexpr char const team[] = "team";
+		static constexpr char const items[] = "items";
+		using type = json_member_list<
+		  json_string<name>, json_number<score, int>, json_class<position, Position>,
+		  json_string_null<team, std::optional<std::string>>,
+		  json_array<items, int>>;
+
+		static constexpr auto to_json_data( Player const &v ) {
+			return std::forward_as_tuple( v.name, v.score, v.position, v.team,
+			                              v.items );
+		}
+	};
+} // namespace daw::json
+
+int main( ) {
+	auto const p0 =
+	  Player{ "p", 10, Position{ 1.0, 2.0 }, std::string( "red" ), { 1, 2 } };
+	{
+		// Unchanged values produce an empty patch
+		daw_ensure( daw::json::to_json_diff( p0, p0 ) == "{}" );
+	}
+	{
+		// Only changed members, nested classes are diffed recursively
+		auto p1 = p0;
+		p1.score = 11;
+		p1.position.y = 3.5;
+		daw_ensure( daw::json::to_json_diff( p0, p1 ) ==
+		            R"({"score":11,"position":{"y":3.5}})" );
+
+		auto p2 = p0;
+		daw::json::apply_merge_patch( p2, daw::json::to_json_diff( p0, p1 ) );
+		daw_ensure( p2.score == 11 );
+		daw_ensure( p2.position.x == 1.0 );
+		daw_ensure( p2.position.y == 3.5 );
+		daw_ensure( p2.name == "p" );
+		daw_ensure( p2.team == p0.team );
+	}
+	{
+		// Members that became null are removed, arrays are replaced whole
+		auto p1 = p0;
+		p1.team.reset( );
+		p1.items.push_back( 3 );
+		auto const patch = daw::json::to_json_diff( p0, p1 );
+		daw_ensure( patch == R"({"team":null,"items":[1,2,3]})" );
+
+		auto p2 = p0;
+		daw::json::apply_merge_patch( p2, patch );
+		daw_ensure( not p2.team );
+		daw_ensure( p2.items == p1.items );
+	}
+	{
+		// Patches can list members in any order and contain unknown members
+		auto p1 = p0;
+		daw::json::apply_merge_patch(
+		  p1, std::string_view(
+		        R"({"extra":true,"position":{"x":-1},"name":"q","team":"blue"})" ) );
+		daw_ensure( p1.name == "q" );
+		daw_ensure( p1.position.x == -1.0 );
+		daw_ensure( p1.position.y == 2.0 );
+		daw_ensure( p1.team == std::optional<std::string>( "blue" ) );
+		daw_ensure( p1.score == 10 );
+	}
+	{
+		// Members are patched in place, the others are not copied and the
+		// storage of the patched ones is reused
+		auto p1 = p0;
+		p1.name = std::string( 64, 'n' );
+		p1.items.reserve( 16 );
+		auto const *const name_data = p1.name.data( );
+		auto const *const items_data = p1.items.data( );
+		daw::json::apply_merge_patch( p1,
+		                              std::string_view( R"({"items":[4,5,6]})" ) );
+		daw_ensure( p1.name.data( ) == name_data );
+		daw_ensure( p1.items.data( ) == items_data );
+		daw_ensure( p1.items == std::vector<int>{ 4, 5, 6 } );
+	}
+}
@@ -0,0 +1,96 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#if not defined( DAW_JSON_PARSER_DIAGNOSTICS )
+#define DAW_JSON_PARSER_DIAGNOSTICS
+#endif
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_parser_stats.h>
+
+#include <daw/daw_ensure.h>
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct Point {
+	int x;
+	int y;
+	std::string name;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Point> {
+		static constexpr char const x[] = "x";
+		static constexpr char const y[] = "y";
+		static constexpr char const name[] = "name";
+		using type = json_member_list<json_number<x, int>, json_number<y, int>,
+		                              json_string<name>>;
+
+		static auto to_json_data( Point const &v ) {
+			return std::forward_as_tuple( v.x, v.y, v.name );
+		}
+	};
+} // namespace daw::json
+
+daw::json::json_parser_stats find_stats( std::string_view type_name ) {
+	auto const stats = daw::json::get_parser_stats( );
+	auto pos = std::find_if( stats.begin( ), stats.end( ), [&]( auto const &s ) {
+		return s.type_name.find( type_name ) != std::string_view::npos;
+	} );
+	daw_ensure( pos != stats.end( ) );
+	return *pos;
+}
+
+int main( ) {
+	using namespace daw::json;
+	reset_parser_stats( );
+	{
+		// y is before x and extra is not mapped
+		auto const p = from_json<Point>(
+		  R"({"y":2,"extra":[1,2,3],"x":1,"name":"a\nb"})" );
+		daw_ensure( p.x == 1 and p.y == 2 and p.name == "a\nb" );
+		auto const stats = find_stats( "Point" );
+		daw_ensure( stats.classes_parsed == 1 );
+		daw_ensure( stats.out_of_order_members == 1 );
+		daw_ensure( stats.unknown_members == 1 );
+		daw_ensure( stats.slow_path_strings == 1 );
+	}
+	{
+		// In order and without escapes the fast paths are taken
+		(void)from_json<Point>( R"({"x":1,"y":2,"name":"ab"})" );
+		auto const stats = find_stats( "Point" );
+		daw_ensure( stats.classes_parsed == 2 );
+		daw_ensure( stats.out_of_order_members == 1 );
+		daw_ensure( stats.unknown_members == 1 );
+		daw_ensure( stats.slow_path_strings == 1 );
+	}
+	{
+		// A large array of unknown size outgrows its reservation, outside of any
+		// class it is counted at the top level
+		auto json_doc = std::string( "[" );
+		for( int n = 0; n < 1000; ++n ) {
+			json_doc += std::to_string( n );
+			json_doc += ',';
+		}
+		json_doc.back( ) = ']';
+		auto const v = from_json<std::vector<int>>( json_doc );
+		daw_ensure( v.size( ) == 1000 );
+		daw_ensure( find_stats( "(top level)" ).array_regrowths == 1 );
+	}
+	{
+		auto const dump = to_json_array( get_parser_stats( ) );
+		daw_ensure( dump.find( "\"out_of_order_members\":1" ) !=
+		            std::string::npos );
+	}
+	reset_parser_stats( );
+	daw_ensure( find_stats( "Point" ).classes_parsed == 0 );
+}
@@ -0,0 +1,94 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include <daw/json/daw_json_link.h>
+
+#include <daw/daw_ensure.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct Inner {
+	int x;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Inner> {
+		static constexpr char const x[] = "x";
+		using type = json_member_list<json_number<x, int>>;
+	};
+} // namespace daw::json
+
+struct Record {
+	int id;
+	std::string name;
+	std::vector<int> values;
+	Inner inner;
+	double score;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Record> {
+		static constexpr char const id[] = "id";
+		static constexpr char const name[] = "name";
+		static constexpr char const values[] = "values";
+		static constexpr char const inner[] = "inner";
+		static constexpr char const score[] = "score";
+		using type =
+		  json_member_list<json_number<id, int>, json_string<name>,
+		                   json_array<values, int>, json_class<inner, Inner>,
+		                   json_number<score>>;
+	};
+} // namespace daw::json
+
+int main( ) {
+	using namespace daw::json;
+	constexpr std::string_view doc =
+	  R"({"score":1.5,"values":[1,2,3],"name":"n","inner":{"x":4},"id":7})";
+
+	// Only the selected members are parsed, the rest are value initialized
+	auto const r0 =
+	  from_json<Record>( doc, json_projection<Record>{ "id", "inner" } );
+	daw_ensure( r0.id == 7 );
+	daw_ensure( r0.inner.x == 4 );
+	daw_ensure( r0.name.empty( ) );
+	daw_ensure( r0.values.empty( ) );
+	daw_ensure( r0.score == 0.0 );
+
+	auto p1 = json_projection<Record>{ };
+	p1.include( "score" ).include( "values" );
+	daw_ensure( p1.contains( 4 ) );
+	daw_ensure( not p1.contains( 0 ) );
+	auto const r1 = from_json<Record>( doc, p1 );
+	daw_ensure( r1.score == 1.5 );
+	daw_ensure( r1.values.size( ) == 3 );
+	daw_ensure( r1.id == 0 );
+
+	// Members that are required but not projected do not need to be present
+	auto const r2 = from_json<Record>( R"({"name":"only"})",
+	                                   json_projection<Record>{ "name" } );
+	daw_ensure( r2.name == "only" );
+
+	// Projections work with exact class mappings
+	auto const r3 = from_json<Record>(
+	  doc, json_projection<Record>{ "name" },
+	  options::parse_flags<options::UseExactMappingsByDefault::yes> );
+	daw_ensure( r3.name == "n" );
+#if defined( DAW_USE_EXCEPTIONS )
+	bool has_error = false;
+	try {
+		(void)json_projection<Record>{ "missing" };
+	} catch( json_exception const & ) {
+		has_error = true;
+	}
+	daw_ensure( has_error );
+#endif
+}
@@ -8,7 +8,11 @@
 
 #include <daw/json/daw_json_link.h>
 
+#include <daw/daw_ensure.h>
+
 #include <optional>
+#include <string>
+#include <vector>
 
 struct Raw {
 	daw::json::json_value raw_json;
@@ -50,6 +54,131 @@ constexpr auto nr0 =
 static_assert( nr0.raw_json );
 static_assert( nr0.raw_json->is_array( ) );
 
+struct Inner {
+	int a;
+	std::vector<int> b;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Inner> {
+		static constexpr char const a[] = "a";
+		static constexpr char const b[] = "b";
+		using type = json_member_list<json_number<a, int>, json_array<b, int>>;
+
+		static auto to_json_data( Inner const &v ) {
+			return std::forward_as_tuple( v.a, v.b );
+		}
+	};
+} // namespace daw::json
+
+struct Preserved {
+	std::string name;
+	daw::json::json_preserved_value<Inner> inner;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Preserved> {
+		static constexpr char const name[] = "name";
+		static constexpr char const inner[] = "inner";
+		using type =
+		  json_member_list<json_string<name>, json_preserved<inner, Inner>>;
+
+		static auto to_json_data( Preserved const &v ) {
+			return std::forward_as_tuple( v.name, v.inner );
+		}
+	};
+} // namespace daw::json
+
+struct Lazy {
+	std::string name;
+	daw::json::json_lazy_value<Inner> inner;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Lazy> {
+		static constexpr char const name[] = "name";
+		static constexpr char const inner[] = "inner";
+		using type = json_member_list<json_string<name>, json_lazy<inner, Inner>>;
+
+		static auto to_json_data( Lazy const &v ) {
+			return std::forward_as_tuple( v.name, v.inner );
+		}
+	};
+} // namespace daw::json
+
 int main( ) {
-	//
+	constexpr std::string_view doc =
+	  R"json({"name":"x","inner":{ "b" : [ 1, 2 ],  "a":5 }})json";
+	auto p = daw::json::from_json<Preserved>( doc );
+	daw_ensure( not p.inner.is_dirty( ) );
+	daw_ensure( p.inner->a == 5 );
+	daw_ensure( p.inner->b.size( ) == 2 );
+	daw_ensure( p.inner.source( ) == R"json({ "b" : [ 1, 2 ],  "a":5 })json" );
+
+	// Unmodified values are written back exactly as they were parsed
+	p.name = "y";
+	daw_ensure( daw::json::to_json( p ) ==
+	            R"json({"name":"y","inner":{ "b" : [ 1, 2 ],  "a":5 }})json" );
+
+	// Once modified, the mapping of Inner is used
+	p.inner.mutable_value( ).a = 6;
+	daw_ensure( p.inner.is_dirty( ) );
+	daw_ensure( p.inner.source( ).empty( ) );
+	daw_ensure( daw::json::to_json( p ) ==
+	            R"json({"name":"y","inner":{"a":6,"b":[1,2]}})json" );
+
+	// Strings keep their quotes and escapes
+	using preserved_string_t = daw::json::json_preserved_value<std::string>;
+	auto const s =
+	  daw::json::from_json<preserved_string_t>( R"json("a\tb")json" );
+	daw_ensure( *s == "a\tb" );
+	daw_ensure( daw::json::to_json( s ) == R"json("a\tb")json" );
+
+	// The value is parsed with the document's options and trailing comments
+	// are not part of the source
+	constexpr std::string_view commented_doc =
+	  R"json({"name":"x",/*a*/"inner":{"a":5,/*b*/"b":[1]} /*c*/})json";
+	auto const c = daw::json::from_json<Preserved>(
+	  commented_doc, daw::json::options::parse_flags<
+	                   daw::json::options::PolicyCommentTypes::cpp> );
+	daw_ensure( c.inner->a == 5 );
+	daw_ensure( c.inner.source( ) == R"json({"a":5,/*b*/"b":[1]})json" );
+
+	// Members found out of order keep the same text
+	constexpr std::string_view reordered_doc =
+	  R"json({"inner":{"a":7,"b":[]} ,"name":"x"})json";
+	auto const r = daw::json::from_json<Preserved>( reordered_doc );
+	daw_ensure( r.inner->a == 7 );
+	daw_ensure( r.inner.source( ) == R"json({"a":7,"b":[]})json" );
+
+	// Lazy members are only parsed when accessed
+	auto l = daw::json::from_json<Lazy>( doc );
+	daw_ensure( not l.inner.is_parsed( ) );
+	daw_ensure( daw::json::to_json( l ) ==
+	            R"json({"name":"x","inner":{ "b" : [ 1, 2 ],  "a":5 }})json" );
+	daw_ensure( l.inner->a == 5 );
+	daw_ensure( l.inner.is_parsed( ) );
+	daw_ensure( not l.inner.is_dirty( ) );
+	daw_ensure( daw::json::to_json( l ) ==
+	            R"json({"name":"x","inner":{ "b" : [ 1, 2 ],  "a":5 }})json" );
+
+	l.inner.mutable_value( ).b.push_back( 3 );
+	daw_ensure( l.inner.is_dirty( ) );
+	daw_ensure( daw::json::to_json( l ) ==
+	            R"json({"name":"x","inner":{"a":5,"b":[1,2,3]}})json" );
+
+	// Lazy members are parsed with the options of the document they came from
+	auto const lc = daw::json::from_json<Lazy>(
+	  commented_doc, daw::json::options::parse_flags<
+	                   daw::json::options::PolicyCommentTypes::cpp> );
+	daw_ensure( lc.inner.source( ) == R"json({"a":5,/*b*/"b":[1]})json" );
+	daw_ensure( lc.inner->a == 5 );
+	daw_ensure( lc.inner->b.size( ) == 1 );
+
+	auto const lr = daw::json::from_json<Lazy>( reordered_doc );
+	daw_ensure( lr.inner.source( ) == R"json({"a":7,"b":[]})json" );
+	daw_ensure( lr.inner->a == 7 );
 }
@@ -0,0 +1,108 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include <daw/json/daw_json_link.h>
+
+#include <daw/daw_ensure.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct Event {
+	daw::json::interned_string kind;
+	daw::json::interned_string source;
+	int id;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Event> {
+		static constexpr char const kind[] = "kind";
+		static constexpr char const source[] = "source";
+		static constexpr char const id[] = "id";
+		using type = json_member_list<json_link<kind, interned_string>,
+		                              json_string<source, interned_string>,
+		                              json_number<id, int>>;
+
+		static auto to_json_data( Event const &v ) {
+			return std::forward_as_tuple( v.kind, v.source, v.id );
+		}
+	};
+} // namespace daw::json
+
+int main( ) {
+	using namespace daw::json;
+	{
+		auto pool = json_string_pool( );
+		auto const a = pool.intern( "abc" );
+		auto const b = pool.intern( std::string( "abc" ) );
+		daw_ensure( a == b );
+		daw_ensure( a.data( ) == b.data( ) );
+		daw_ensure( pool.intern( "abd" ) != a );
+		daw_ensure( pool.size( ) == 2 );
+		daw_ensure( interned_string( ) == interned_string( ) );
+	}
+	{
+		// Repeated values, including escaped ones, share one copy
+		std::string_view const json_doc = R"([
+			{"kind":"click","source":"web","id":1},
+			{"kind":"click","source":"web","id":2},
+			{"kind":"view","source":"app","id":3},
+			{"kind":"click","source":"w\u0065b","id":4}
+		])";
+		auto pool = json_string_pool( );
+		auto events = std::vector<Event>( );
+		{
+			auto const scope = json_string_pool_scope( pool );
+			events = from_json_array<Event>( json_doc );
+		}
+		daw_ensure( events.size( ) == 4 );
+		daw_ensure( pool.size( ) == 4 );
+		daw_ensure( events[0].kind == "click" );
+		daw_ensure( events[0].kind.data( ) == events[1].kind.data( ) );
+		daw_ensure( events[0].kind.data( ) == events[3].kind.data( ) );
+		daw_ensure( events[0].source.data( ) == events[1].source.data( ) );
+		daw_ensure( events[0].source.data( ) == events[3].source.data( ) );
+		daw_ensure( events[2].kind == "view" );
+		daw_ensure( events[2].source == "app" );
+
+		auto const json_str = to_json( events[1] );
+		auto const e2 = [&] {
+			auto const scope = json_string_pool_scope( pool );
+			return from_json<Event>( json_str );
+		}( );
+		daw_ensure( e2.kind.data( ) == events[1].kind.data( ) );
+		daw_ensure( e2.id == 2 );
+		daw_ensure( pool.size( ) == 4 );
+	}
+	{
+		// Nested scopes restore the outer pool
+		auto outer = json_string_pool( );
+		auto inner = json_string_pool( );
+		auto const scope = json_string_pool_scope( outer );
+		{
+			auto const scope2 = json_string_pool_scope( inner );
+			(void)from_json<interned_string>( std::string_view( R"("x")" ) );
+		}
+		(void)from_json<interned_string>( std::string_view( R"("y")" ) );
+		daw_ensure( inner.size( ) == 1 );
+		daw_ensure( outer.size( ) == 1 );
+	}
+#if defined( DAW_USE_EXCEPTIONS )
+	{
+		bool has_error = false;
+		try {
+			(void)from_json<interned_string>( std::string_view( R"("x")" ) );
+		} catch( json_exception const &je ) {
+			has_error = je.reason_type( ) == ErrorReason::MissingStringPool;
+		}
+		daw_ensure( has_error );
+	}
+#endif
+}
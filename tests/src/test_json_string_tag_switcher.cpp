@@ -0,0 +1,72 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include <daw/json/daw_json_link.h>
+
+#include <daw/daw_ensure.h>
+
+#include <string>
+#include <string_view>
+#include <variant>
+
+struct Message {
+	std::variant<std::string, int, bool> body;
+};
+
+static constexpr char const text_tag[] = "text";
+static constexpr char const number_tag[] = "number";
+static constexpr char const flag_tag[] = "flag";
+
+struct MessageSwitcher
+  : daw::json::json_string_tag_switcher<text_tag, number_tag, flag_tag> {
+	using json_string_tag_switcher::operator( );
+
+	std::string_view operator( )( Message const &v ) const {
+		return tag_at( v.body.index( ) );
+	}
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Message> {
+		static constexpr char const body[] = "body";
+		static constexpr char const type_mem[] = "type";
+		using type = json_member_list<json_tagged_variant<
+		  body, std::variant<std::string, int, bool>,
+		  json_string_raw<type_mem, std::string_view>, MessageSwitcher>>;
+
+		static auto to_json_data( Message const &v ) {
+			return std::forward_as_tuple( v.body );
+		}
+	};
+} // namespace daw::json
+
+int main( ) {
+	using namespace daw::json;
+	static_assert( MessageSwitcher{ }( "text" ) == 0 );
+	static_assert( MessageSwitcher{ }( "flag" ) == 2 );
+	static_assert( MessageSwitcher{ }( "other" ) == MessageSwitcher::tag_count );
+
+	auto const m0 = from_json<Message>( R"({"type":"number","body":5})" );
+	daw_ensure( std::get<int>( m0.body ) == 5 );
+
+	auto const m1 = from_json<Message>( R"({"body":"hi","type":"text"})" );
+	daw_ensure( std::get<std::string>( m1.body ) == "hi" );
+
+	auto const m2 = from_json<Message>( to_json( Message{ true } ) );
+	daw_ensure( std::get<bool>( m2.body ) );
+#if defined( DAW_USE_EXCEPTIONS )
+	bool has_error = false;
+	try {
+		(void)from_json<Message>( R"({"type":"unknown","body":5})" );
+	} catch( json_exception const & ) {
+		has_error = true;
+	}
+	daw_ensure( has_error );
+#endif
+}
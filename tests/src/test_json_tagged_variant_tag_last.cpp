@@ -0,0 +1,129 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Tagged variants whose tag comes after them in the object are parsed while
+// scanning the object once
+
+#include <daw/json/daw_json_link.h>
+
+#include <daw/daw_ensure.h>
+
+#include <string>
+#include <variant>
+
+struct Event {
+	int id;
+	std::variant<std::string, int, bool> payload;
+	std::string source;
+};
+
+struct EventSwitcher {
+	constexpr std::size_t operator( )( int type ) const {
+		return static_cast<std::size_t>( type );
+	}
+	int operator( )( Event const &v ) const {
+		return static_cast<int>( v.payload.index( ) );
+	}
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Event> {
+		static constexpr char const id[] = "id";
+		static constexpr char const payload[] = "payload";
+		static constexpr char const type_mem[] = "type";
+		static constexpr char const source[] = "source";
+		using type = json_member_list<
+		  json_number<id, int>,
+		  json_tagged_variant<payload, std::variant<std::string, int, bool>,
+		                      json_number<type_mem, int>, EventSwitcher>,
+		  json_string<source>>;
+
+		static auto to_json_data( Event const &v ) {
+			return std::forward_as_tuple( v.id, v.payload, v.source );
+		}
+	};
+} // namespace daw::json
+
+// The tag is also a member of the class, mapped after the variant
+struct MappedEvent {
+	std::variant<std::string, int, bool> payload;
+	int type;
+};
+
+struct MappedEventSwitcher {
+	constexpr std::size_t operator( )( int type ) const {
+		return static_cast<std::size_t>( type );
+	}
+	int operator( )( MappedEvent const &v ) const {
+		return static_cast<int>( v.payload.index( ) );
+	}
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<MappedEvent> {
+		static constexpr char const payload[] = "payload";
+		static constexpr char const type_mem[] = "type";
+		using type = json_member_list<
+		  json_tagged_variant<payload, std::variant<std::string, int, bool>,
+		                      json_number<type_mem, int>, MappedEventSwitcher>,
+		  json_number<type_mem, int>>;
+
+		static auto to_json_data( MappedEvent const &v ) {
+			return std::forward_as_tuple( v.payload, v.type );
+		}
+	};
+} // namespace daw::json
+
+int main( ) {
+	using namespace daw::json;
+	{
+		// Tag last, after a member that is needed later
+		auto const e = from_json<Event>(
+		  R"({"id":1,"payload":"hello","source":"a","type":0})" );
+		daw_ensure( e.id == 1 );
+		daw_ensure( std::get<std::string>( e.payload ) == "hello" );
+		daw_ensure( e.source == "a" );
+	}
+	{
+		// Tag last with unknown members and members out of order
+		auto const e = from_json<Event>(
+		  R"({"source":"b","payload":42,"extra":[1,2],"id":2,"type":1})" );
+		daw_ensure( e.id == 2 );
+		daw_ensure( std::get<int>( e.payload ) == 42 );
+		daw_ensure( e.source == "b" );
+	}
+	{
+		// Tag first is still supported
+		auto const e = from_json<Event>(
+		  R"({"type":2,"id":3,"payload":true,"source":"c"})" );
+		daw_ensure( e.id == 3 );
+		daw_ensure( std::get<bool>( e.payload ) );
+		daw_ensure( e.source == "c" );
+	}
+	{
+		// The tag of the variant does not need to be mapped in exact classes
+		auto const e = from_json<Event>(
+		  R"({"id":4,"payload":"x","source":"d","type":0})",
+		  options::parse_flags<options::UseExactMappingsByDefault::yes> );
+		daw_ensure( std::get<std::string>( e.payload ) == "x" );
+		daw_ensure( e.source == "d" );
+	}
+	{
+		auto const e =
+		  from_json<MappedEvent>( R"({"payload":"y","type":0})" );
+		daw_ensure( std::get<std::string>( e.payload ) == "y" );
+		daw_ensure( e.type == 0 );
+	}
+	{
+		auto const e = from_json<Event>( to_json( Event{ 5, 7, "e" } ) );
+		daw_ensure( e.id == 5 );
+		daw_ensure( std::get<int>( e.payload ) == 7 );
+		daw_ensure( e.source == "e" );
+	}
+}